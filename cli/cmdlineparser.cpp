@@ -143,6 +143,10 @@ bool CmdLineParser::ParseFromArgs(int argc, const char* const argv[])
             else if (std::strcmp(argv[i], "--debug-warnings") == 0)
                 _settings->debugwarnings = true;
 
+            // Compare fused simplifications with sequential simplifications
+            else if (std::strcmp(argv[i], "--debug-simplify-rules") == 0)
+                _settings->debugSimplifyRules = true;
+
             // dump cppcheck data
             else if (std::strcmp(argv[i], "--dump") == 0)
                 _settings->dump = true;
@@ -249,6 +253,20 @@ bool CmdLineParser::ParseFromArgs(int argc, const char* const argv[])
             else if (std::strcmp(argv[i], "-f") == 0 || std::strcmp(argv[i], "--force") == 0)
                 _settings->force = true;
 
+            // Check the functions of a file in several processes
+            else if (std::strncmp(argv[i], "--function-jobs=", 16) == 0) {
+                std::istringstream iss(16+argv[i]);
+                if (!(iss >> _settings->functionJobs)) {
+                    PrintMessage("cppcheck: argument to '--function-jobs=' is not a number.");
+                    return false;
+                }
+
+                if (_settings->functionJobs < 1 || _settings->functionJobs > 1000) {
+                    PrintMessage("cppcheck: argument to '--function-jobs=' must be between 1 and 1000.");
+                    return false;
+                }
+            }
+
             // Output relative paths
             else if (std::strcmp(argv[i], "-rp") == 0 || std::strcmp(argv[i], "--relative-paths") == 0)
                 _settings->relativePaths = true;
@@ -631,6 +649,8 @@ bool CmdLineParser::ParseFromArgs(int argc, const char* const argv[])
                     _settings->showtime = SHOWTIME_SUMMARY;
                 else if (showtimeMode == "top5")
                     _settings->showtime = SHOWTIME_TOP5;
+                else if (showtimeMode == "tree")
+                    _settings->showtime = SHOWTIME_TREE;
                 else if (showtimeMode.empty())
                     _settings->showtime = SHOWTIME_NONE;
                 else {
@@ -882,6 +902,12 @@ void CmdLineParser::PrintHelp()
               "    -f, --force          Force checking of all configurations in files. If used\n"
               "                         together with '--max-configs=', the last option is the\n"
               "                         one that is effective.\n"
+#ifdef THREADING_MODEL_FORK
+              "    --function-jobs=<n>  Run the checks on the functions of each file in <n>\n"
+              "                         processes. The results are the same as when the\n"
+              "                         functions are checked in one process. Ignored when\n"
+              "                         --showtime is used.\n"
+#endif
               "    -h, --help           Print this help.\n"
               "    -I <dir>             Give path to search for include files. Give several -I\n"
               "                         parameters to give several paths. First given path is\n"
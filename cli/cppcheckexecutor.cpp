@@ -23,6 +23,7 @@
 #include "config.h"
 #include "cppcheck.h"
 #include "filelister.h"
+#include "functionexecutor.h"
 #include "importproject.h"
 #include "library.h"
 #include "path.h"
@@ -78,7 +79,7 @@
 /*static*/ FILE* CppCheckExecutor::exceptionOutput = stdout;
 
 CppCheckExecutor::CppCheckExecutor()
-    : _settings(0), time1(0), errorOutput(nullptr), errorlist(false)
+    : _settings(0), time1(0), progressStageStart(0), errorOutput(nullptr), errorlist(false)
 {
 }
 
@@ -180,6 +181,8 @@ int CppCheckExecutor::check(int argc, const char* const argv[])
     Preprocessor::missingSystemIncludeFlag = false;
 
     CppCheck cppCheck(*this, true);
+    FunctionExecutor functionExecutor;
+    cppCheck.setPartsExecutor(&functionExecutor);
 
     const Settings& settings = cppCheck.settings();
     _settings = &settings;
@@ -962,8 +965,15 @@ void CppCheckExecutor::reportProgress(const std::string &filename, const char st
     if (!time1)
         return;
 
-    // Report progress messages every 10 seconds
     const std::time_t time2 = std::time(nullptr);
+
+    // Remember when the current stage was started
+    if (progressStage != stage) {
+        progressStage = stage;
+        progressStageStart = time2;
+    }
+
+    // Report progress messages every 10 seconds
     if (time2 >= (time1 + 10)) {
         time1 = time2;
 
@@ -973,6 +983,11 @@ void CppCheckExecutor::reportProgress(const std::string &filename, const char st
              << stage
              << ' ' << value << '%';
 
+        // estimate the remaining time of this stage
+        const std::time_t elapsed = time2 - progressStageStart;
+        if (value > 0 && value < 100 && elapsed > 0)
+            ostr << " (ETA " << elapsed * (100 - value) / value << "s)";
+
         // Report progress message
         reportOut(ostr.str());
     }
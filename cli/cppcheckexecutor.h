@@ -171,6 +171,12 @@ private:
      */
     std::time_t time1;
 
+    /**
+     * Stage of the last progress report and the time it was started
+     */
+    std::string progressStage;
+    std::time_t progressStageStart;
+
     /**
      * Output file name for exception handler
      */
@@ -0,0 +1,310 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2016 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "functionexecutor.h"
+
+#include "mathlib.h"
+#include "threadexecutor.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <sstream>
+#include <vector>
+
+#ifdef THREADING_MODEL_FORK
+#include <sys/select.h>
+#include <sys/wait.h>
+#include <errno.h>
+#include <iostream>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+// required for FD_ZERO
+using std::memset;
+
+namespace {
+    std::string childPacket(char type, const std::string &data)
+    {
+        return type + MathLib::toString(data.size()) + ' ' + data;
+    }
+
+    /** Read the packet at pos, returns false if it is malformed or truncated */
+    bool nextChildPacket(const std::string &data, std::string::size_type *pos, char *type, std::string *packet)
+    {
+        const std::string::size_type space = data.find(' ', *pos);
+        if (space == std::string::npos || space == *pos + 1)
+            return false;
+        const std::string len = data.substr(*pos + 1, space - *pos - 1);
+        if (len.find_first_not_of("0123456789") != std::string::npos)
+            return false;
+        const std::size_t size = MathLib::toULongNumber(len);
+        if (size > data.size() - space - 1)
+            return false;
+        *type = data[*pos];
+        *packet = data.substr(space + 1, size);
+        *pos = space + 1 + size;
+        return true;
+    }
+}
+
+bool FunctionExecutor::reportChildOutput(const std::string &data, ErrorLogger &errorLogger)
+{
+    std::string::size_type pos = 0;
+    while (pos < data.size()) {
+        char type;
+        std::string packet;
+        if (!nextChildPacket(data, &pos, &type, &packet))
+            return false;
+        if (type == 'O') {
+            errorLogger.reportOut(packet);
+        } else if (type == 'E') {
+            ErrorLogger::ErrorMessage msg;
+            std::string columns;
+            bool hasMessage = false;
+            std::string::size_type errorPos = 0;
+            while (errorPos < packet.size()) {
+                char errorType;
+                std::string errorPacket;
+                if (!nextChildPacket(packet, &errorPos, &errorType, &errorPacket))
+                    return false;
+                if (errorType == 'F') {
+                    msg.file0 = errorPacket;
+                } else if (errorType == 'L') {
+                    columns = errorPacket;
+                } else if (errorType == 'M') {
+                    try {
+                        if (!msg.deserialize(errorPacket))
+                            return false;
+                    } catch (const InternalError &) {
+                        return false;
+                    }
+                    hasMessage = true;
+                }
+            }
+            if (!hasMessage)
+                return false;
+            std::istringstream istr(columns);
+            for (std::list<ErrorLogger::ErrorMessage::FileLocation>::iterator loc = msg._callStack.begin(); loc != msg._callStack.end(); ++loc)
+                istr >> loc->col;
+            errorLogger.reportErr(msg);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+////// This code is for platforms that support fork() only ////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+#if defined(THREADING_MODEL_FORK)
+
+namespace {
+    /** Sends the output of a child process to the parent through a pipe */
+    class ChildErrorLogger : public ErrorLogger {
+    public:
+        explicit ChildErrorLogger(int fd) : _fd(fd), _failed(false) {
+        }
+
+        virtual void reportOut(const std::string &outmsg) {
+            send('O', outmsg);
+        }
+
+        /** serialize() drops file0 and the columns, they are sent in packets of their own */
+        virtual void reportErr(const ErrorLogger::ErrorMessage &msg) {
+            std::string columns;
+            for (std::list<ErrorLogger::ErrorMessage::FileLocation>::const_iterator loc = msg._callStack.begin(); loc != msg._callStack.end(); ++loc)
+                columns += MathLib::toString(loc->col) + ' ';
+            send('E', childPacket('F', msg.file0) + childPacket('L', columns) + childPacket('M', msg.serialize()));
+        }
+
+        /** Did a write to the pipe fail? Then the parent did not get all output. */
+        bool failed() const {
+            return _failed;
+        }
+
+    private:
+        void send(char type, const std::string &data) {
+            if (_failed)
+                return;
+            const std::string packet = childPacket(type, data);
+            std::size_t pos = 0;
+            while (pos < packet.size()) {
+                const ssize_t n = write(_fd, packet.data() + pos, packet.size() - pos);
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n <= 0) {
+                    _failed = true;
+                    return;
+                }
+                pos += n;
+            }
+        }
+
+        int _fd;
+        bool _failed;
+    };
+
+    /** Read from the pipes until all children closed them */
+    std::vector<std::string> readChildOutput(std::vector<int> &pipes)
+    {
+        std::vector<std::string> output(pipes.size());
+        std::size_t remaining = pipes.size();
+        while (remaining > 0) {
+            fd_set rfds;
+            FD_ZERO(&rfds);
+            int maxfd = 0;
+            for (std::size_t i = 0; i < pipes.size(); ++i) {
+                if (pipes[i] < 0)
+                    continue;
+                FD_SET(pipes[i], &rfds);
+                maxfd = std::max(maxfd, pipes[i]);
+            }
+            if (select(maxfd + 1, &rfds, nullptr, nullptr, nullptr) < 0) {
+                if (errno == EINTR)
+                    continue;
+                break;
+            }
+            for (std::size_t i = 0; i < pipes.size(); ++i) {
+                if (pipes[i] < 0 || !FD_ISSET(pipes[i], &rfds))
+                    continue;
+                char buf[4096];
+                const ssize_t n = read(pipes[i], buf, sizeof(buf));
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n > 0) {
+                    output[i].append(buf, n);
+                    continue;
+                }
+                close(pipes[i]);
+                pipes[i] = -1;
+                --remaining;
+            }
+        }
+        for (std::size_t i = 0; i < pipes.size(); ++i) {
+            if (pipes[i] >= 0)
+                close(pipes[i]);
+        }
+        return output;
+    }
+
+    /** Wait for the children, returns false if one of them crashed or failed */
+    bool waitForChildren(const std::vector<pid_t> &children)
+    {
+        bool ok = true;
+        for (std::size_t i = 0; i < children.size(); ++i) {
+            int status = 0;
+            while (waitpid(children[i], &status, 0) < 0 && errno == EINTR) {}
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+                ok = false;
+        }
+        return ok;
+    }
+
+    void killChildren(const std::vector<int> &pipes, const std::vector<pid_t> &children)
+    {
+        for (std::size_t i = 0; i < pipes.size(); ++i)
+            close(pipes[i]);
+        for (std::size_t i = 0; i < children.size(); ++i) {
+            kill(children[i], SIGKILL);
+            waitpid(children[i], nullptr, 0);
+        }
+    }
+}
+
+bool FunctionExecutor::run(CppCheck &cppcheck, const Tokenizer &tokenizer, bool simplified, std::size_t parts, ErrorLogger &errorLogger, std::string *failure)
+{
+    // Output that is not flushed would be written again by the children
+    std::cout.flush();
+    std::cerr.flush();
+
+    std::vector<int> pipes;
+    std::vector<pid_t> children;
+    for (std::size_t part = 0; part < parts; ++part) {
+        int fds[2];
+        pid_t pid = -1;
+        if (pipe(fds) == 0) {
+            pid = fork();
+            if (pid < 0) {
+                close(fds[0]);
+                close(fds[1]);
+            }
+        }
+        if (pid < 0) {
+            // Fall back to checking all function scopes in this process
+            killChildren(pipes, children);
+            return false;
+        }
+
+        if (pid == 0) {
+            close(fds[0]);
+            for (std::size_t i = 0; i < pipes.size(); ++i)
+                close(pipes[i]);
+
+            ChildErrorLogger childErrorLogger(fds[1]);
+            cppcheck.runChecksOfPart(tokenizer, simplified, part, childErrorLogger);
+            close(fds[1]);
+            _exit(childErrorLogger.failed() ? EXIT_FAILURE : EXIT_SUCCESS);
+        }
+
+        close(fds[1]);
+        pipes.push_back(fds[0]);
+        children.push_back(pid);
+    }
+
+    const std::vector<std::string> output = readChildOutput(pipes);
+    const bool finished = waitForChildren(children);
+
+    // Report in the order of the parts so the output does not depend on
+    // which child finished first
+    bool malformed = false;
+    for (std::size_t i = 0; i < output.size(); ++i) {
+        if (!reportChildOutput(output[i], errorLogger))
+            malformed = true;
+    }
+
+    if (!finished)
+        *failure = "A process that checked a part of the functions did not finish.";
+    else if (malformed)
+        *failure = "The output of a process that checked a part of the functions is malformed.";
+
+    return true;
+}
+
+bool FunctionExecutor::isEnabled()
+{
+    return true;
+}
+
+#else
+
+bool FunctionExecutor::run(CppCheck &, const Tokenizer &, bool, std::size_t, ErrorLogger &, std::string *)
+{
+    return false;
+}
+
+bool FunctionExecutor::isEnabled()
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2016 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FUNCTIONEXECUTOR_H
+#define FUNCTIONEXECUTOR_H
+
+#include "cppcheck.h"
+#include "errorlogger.h"
+
+#include <cstddef>
+#include <string>
+
+class Tokenizer;
+
+/// @addtogroup CLI
+/// @{
+
+/**
+ * This class runs the parts of --function-jobs in child processes. Each
+ * child sends its output to the parent through a pipe.
+ */
+class FunctionExecutor : public PartsExecutor {
+public:
+    FunctionExecutor() {
+    }
+
+    virtual bool run(CppCheck &cppcheck, const Tokenizer &tokenizer, bool simplified, std::size_t parts, ErrorLogger &errorLogger, std::string *failure);
+
+    /**
+     * @brief Report the output that a child process sent through its pipe
+     * @return false if the output is malformed
+     */
+    static bool reportChildOutput(const std::string &data, ErrorLogger &errorLogger);
+
+    /**
+     * @return true if child processes can be used
+     */
+    static bool isEnabled();
+
+private:
+    /** disabled copy constructor */
+    FunctionExecutor(const FunctionExecutor &);
+
+    /** disabled assignment operator */
+    void operator=(const FunctionExecutor &);
+};
+
+/// @}
+
+#endif // FUNCTIONEXECUTOR_H
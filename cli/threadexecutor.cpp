@@ -21,6 +21,7 @@
 #include "config.h"
 #include "cppcheck.h"
 #include "cppcheckexecutor.h"
+#include "functionexecutor.h"
 #include "importproject.h"
 #include "settings.h"
 #include "suppressions.h"
@@ -213,6 +214,8 @@ unsigned int ThreadExecutor::check()
 
                 CppCheck fileChecker(*this, false);
                 fileChecker.settings() = _settings;
+                FunctionExecutor functionExecutor;
+                fileChecker.setPartsExecutor(&functionExecutor);
                 unsigned int resultOfCheck = 0;
 
                 if (iFileSettings != _settings.project.fileSettings.end()) {
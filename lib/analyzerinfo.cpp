@@ -25,6 +25,79 @@
 #include <cstring>
 #include <map>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+    /** The return values are stored in "<analyzer info file>.retval" */
+    const char returnValuesExtension[] = ".retval";
+
+    /** First bytes of a return value file, the last one is the format version */
+    const char returnValuesMagic[] = "cppcheck-retval2";
+    const std::size_t returnValuesMagicSize = sizeof(returnValuesMagic) - 1U;
+
+    void writeNumber(std::ostream &out, unsigned long long value, unsigned int bytes)
+    {
+        for (unsigned int i = 0; i < bytes; ++i)
+            out.put(static_cast<char>((value >> (8U * i)) & 0xffU));
+    }
+
+    bool readNumber(std::istream &in, unsigned long long *value, unsigned int bytes)
+    {
+        *value = 0;
+        for (unsigned int i = 0; i < bytes; ++i) {
+            const int c = in.get();
+            if (c == EOF)
+                return false;
+            *value |= static_cast<unsigned long long>(c & 0xff) << (8U * i);
+        }
+        return true;
+    }
+
+    /**
+     * Write the return values in a binary format: the magic bytes, the
+     * number of functions and then for each function, sorted by key, the
+     * key length, the key and the value. Numbers are little endian.
+     */
+    void writeReturnValues(const std::string &filename, const std::map<std::string, long long> &values)
+    {
+        std::ofstream fout(filename.c_str(), std::ios::binary);
+        if (!fout.is_open())
+            return;
+        fout.write(returnValuesMagic, returnValuesMagicSize);
+        writeNumber(fout, values.size(), 4U);
+        for (std::map<std::string, long long>::const_iterator it = values.begin(); it != values.end(); ++it) {
+            writeNumber(fout, it->first.size(), 4U);
+            fout.write(it->first.data(), it->first.size());
+            writeNumber(fout, static_cast<unsigned long long>(it->second), 8U);
+        }
+    }
+
+    void readReturnValues(const std::string &filename, std::map<std::string, long long> *values)
+    {
+        std::ifstream fin(filename.c_str(), std::ios::binary);
+        if (!fin.is_open())
+            return;
+        char magic[sizeof(returnValuesMagic)] = {0};
+        unsigned long long count = 0;
+        if (!fin.read(magic, returnValuesMagicSize) || std::strcmp(magic, returnValuesMagic) != 0 || !readNumber(fin, &count, 4U))
+            return;
+        for (unsigned long long i = 0; i < count; ++i) {
+            unsigned long long size = 0, value = 0;
+            if (!readNumber(fin, &size, 4U) || size > 4096U)
+                return;
+            std::string function(size, '\0');
+            if (!fin.read(&function[0], size) || !readNumber(fin, &value, 8U))
+                return;
+            (*values)[function] = static_cast<long long>(value);
+        }
+    }
+}
+
+AnalyzerInformation::AnalyzerInformation() :
+    returnValuesDirty(false)
+{
+}
 
 AnalyzerInformation::~AnalyzerInformation()
 {
@@ -66,14 +139,31 @@ void AnalyzerInformation::writeFilesTxt(const std::string &buildDir, const std::
 
 void AnalyzerInformation::close()
 {
-    analyzerInfoFile.clear();
     if (fout.is_open()) {
+        for (std::map<std::string, std::pair<bool, long long> >::const_iterator it = usedReturnValues.begin(); it != usedReturnValues.end(); ++it) {
+            fout << "  <ReturnValue function=\"" << ErrorLogger::toxml(it->first) << '\"';
+            if (it->second.first)
+                fout << " value=\"" << it->second.second << '\"';
+            fout << "/>\n";
+        }
         fout << "</analyzerinfo>\n";
         fout.close();
+
+        for (std::set<std::string>::const_iterator it = conflictingReturnValues.begin(); it != conflictingReturnValues.end(); ++it)
+            returnValues.erase(*it);
+        writeReturnValues(analyzerInfoFile + returnValuesExtension, returnValues);
+        if (!loadedBuildDir.empty()) {
+            returnValuesByFile[analyzerInfoFile + returnValuesExtension] = returnValues;
+            returnValuesDirty = true;
+        }
     }
+    analyzerInfoFile.clear();
+    returnValues.clear();
+    conflictingReturnValues.clear();
+    usedReturnValues.clear();
 }
 
-static bool skipAnalysis(const std::string &analyzerInfoFile, unsigned long long checksum, std::list<ErrorLogger::ErrorMessage> *errors)
+bool AnalyzerInformation::skipAnalysis(const std::string &buildDir, unsigned long long checksum, std::list<ErrorLogger::ErrorMessage> *errors)
 {
     tinyxml2::XMLDocument doc;
     tinyxml2::XMLError error = doc.LoadFile(analyzerInfoFile.c_str());
@@ -91,6 +181,17 @@ static bool skipAnalysis(const std::string &analyzerInfoFile, unsigned long long
     for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
         if (std::strcmp(e->Name(), "error") == 0)
             errors->push_back(ErrorLogger::ErrorMessage(e));
+        else if (std::strcmp(e->Name(), "ReturnValue") == 0) {
+            // Has the return value of a function in another TU changed?
+            const char *function = e->Attribute("function");
+            const char *value = e->Attribute("value");
+            long long current = 0;
+            const bool found = function && findReturnValue(buildDir, function, &current);
+            if (found != (value != nullptr) || (found && std::to_string(current) != value)) {
+                errors->clear();
+                return false;
+            }
+        }
     }
 
     return true;
@@ -134,7 +235,7 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
 
     analyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg);
 
-    if (skipAnalysis(analyzerInfoFile, checksum, errors))
+    if (skipAnalysis(buildDir, checksum, errors))
         return false;
 
     fout.open(analyzerInfoFile);
@@ -159,3 +260,61 @@ void AnalyzerInformation::setFileInfo(const std::string &check, const std::strin
     if (fout.is_open() && !fileInfo.empty())
         fout << "  <FileInfo check=\"" << check << "\">\n" << fileInfo << "  </FileInfo>\n";
 }
+
+void AnalyzerInformation::setReturnValues(const std::map<std::string, long long> &values)
+{
+    for (std::map<std::string, long long>::const_iterator it = values.begin(); it != values.end(); ++it) {
+        const std::pair<std::map<std::string, long long>::iterator, bool> ins = returnValues.insert(*it);
+        if (!ins.second && ins.first->second != it->second)
+            conflictingReturnValues.insert(it->first);
+    }
+}
+
+bool AnalyzerInformation::getReturnValue(const std::string &buildDir, const std::string &function, long long *value)
+{
+    const bool found = findReturnValue(buildDir, function, value);
+    usedReturnValues[function] = std::make_pair(found, found ? *value : 0LL);
+    return found;
+}
+
+bool AnalyzerInformation::findReturnValue(const std::string &buildDir, const std::string &function, long long *value)
+{
+    if (buildDir != loadedBuildDir)
+        loadReturnValues(buildDir);
+    if (returnValuesDirty)
+        mergeReturnValues();
+    const std::unordered_map<std::string, long long>::const_iterator it = allReturnValues.find(function);
+    if (it == allReturnValues.end())
+        return false;
+    *value = it->second;
+    return true;
+}
+
+void AnalyzerInformation::loadReturnValues(const std::string &buildDir)
+{
+    loadedBuildDir = buildDir;
+    returnValuesByFile.clear();
+    std::ifstream fin((buildDir + "/files.txt").c_str());
+    std::string line;
+    while (std::getline(fin, line)) {
+        const std::string filename(buildDir + '/' + line.substr(0, line.find(':')) + returnValuesExtension);
+        readReturnValues(filename, &returnValuesByFile[filename]);
+    }
+    returnValuesDirty = true;
+}
+
+void AnalyzerInformation::mergeReturnValues()
+{
+    allReturnValues.clear();
+    std::set<std::string> conflicts;
+    for (std::map<std::string, std::map<std::string, long long> >::const_iterator file = returnValuesByFile.begin(); file != returnValuesByFile.end(); ++file) {
+        for (std::map<std::string, long long>::const_iterator it = file->second.begin(); it != file->second.end(); ++it) {
+            const std::pair<std::unordered_map<std::string, long long>::iterator, bool> ins = allReturnValues.insert(*it);
+            if (!ins.second && ins.first->second != it->second)
+                conflicts.insert(it->first);
+        }
+    }
+    for (std::set<std::string>::const_iterator it = conflicts.begin(); it != conflicts.end(); ++it)
+        allReturnValues.erase(*it);
+    returnValuesDirty = false;
+}
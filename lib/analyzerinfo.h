@@ -27,7 +27,11 @@
 
 #include <fstream>
 #include <list>
+#include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 /// @addtogroup Core
 /// @{
@@ -39,6 +43,7 @@
 * - checksum
 * - error messages
 * - whole program analysis data
+* - known return values of the functions, for the ValueFlow of other TUs
 *
 * The information can be used for various purposes. It allows:
 * - 'make' - only analyze TUs that are changed and generate full report
@@ -47,6 +52,7 @@
 */
 class CPPCHECKLIB AnalyzerInformation {
 public:
+    AnalyzerInformation();
     ~AnalyzerInformation();
 
     static void writeFilesTxt(const std::string &buildDir, const std::list<std::string> &sourcefiles, const std::list<ImportProject::FileSettings> &fileSettings);
@@ -57,9 +63,55 @@ public:
     void reportErr(const ErrorLogger::ErrorMessage &msg, bool verbose);
     void setFileInfo(const std::string &check, const std::string &fileInfo);
     static std::string getAnalyzerInfoFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg);
+
+    /** Add the known return values of the functions in one configuration of the current TU */
+    void setReturnValues(const std::map<std::string, long long> &values);
+
+    /**
+     * Get the known return value of a function from the values that the
+     * TUs stored in the build dir. The values are loaded on first use. The
+     * lookup is remembered, if its result changes the current TU is
+     * analyzed again next time.
+     * @param buildDir build dir
+     * @param function function key, "name(argument count)"
+     * @param value the return value is written here
+     */
+    bool getReturnValue(const std::string &buildDir, const std::string &function, long long *value);
 private:
+    bool skipAnalysis(const std::string &buildDir, unsigned long long checksum, std::list<ErrorLogger::ErrorMessage> *errors);
+
+    /** Look up a return value without remembering the lookup */
+    bool findReturnValue(const std::string &buildDir, const std::string &function, long long *value);
+
+    /** Load the return values that the TUs stored in the build dir */
+    void loadReturnValues(const std::string &buildDir);
+
+    /** Merge the return values of all TUs, functions with different values in different TUs are left out */
+    void mergeReturnValues();
+
     std::ofstream fout;
     std::string analyzerInfoFile;
+
+    /** known return values of the current TU */
+    std::map<std::string, long long> returnValues;
+
+    /** functions that return different values in different configurations */
+    std::set<std::string> conflictingReturnValues;
+
+    /** return value lookups of the current TU, second.first is false if there was no value */
+    std::map<std::string, std::pair<bool, long long> > usedReturnValues;
+
+    /** build dir that the return values of all TUs were loaded from */
+    std::string loadedBuildDir;
+
+    /** return values of all TUs per return value file */
+    std::map<std::string, std::map<std::string, long long> > returnValuesByFile;
+
+    /** merged return values of all TUs */
+    std::unordered_map<std::string, long long> allReturnValues;
+
+    /** allReturnValues must be merged again */
+    bool returnValuesDirty;
 };
 
 /// @}
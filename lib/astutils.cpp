@@ -27,6 +27,7 @@
 #include "token.h"
 #include "valueflow.h"
 
+#include <functional>
 #include <list>
 
 static bool astIsCharWithSign(const Token *tok, ValueType::Sign sign)
@@ -238,6 +239,36 @@ bool isSameExpression(bool cpp, bool macro, const Token *tok1, const Token *tok2
     return commutativeEquals;
 }
 
+static std::size_t combineHash(std::size_t seed, std::size_t value)
+{
+    return seed ^ (value + 0x9e3779b9U + (seed << 6) + (seed >> 2));
+}
+
+std::size_t expressionHash(const Token *tok)
+{
+    if (!tok)
+        return 0x12345U;
+    if (tok->str() == "." && tok->astOperand1() && tok->astOperand1()->str() == "this" && tok->astOperand2())
+        tok = tok->astOperand2();
+
+    // 'a>b' is the same as 'b<a'
+    const Token *op1 = tok->astOperand1();
+    const Token *op2 = tok->astOperand2();
+    std::size_t h;
+    if (tok->str() == ">" || tok->str() == ">=") {
+        std::swap(op1, op2);
+        h = std::hash<std::string>()(tok->str() == ">" ? "<" : "<=");
+    } else {
+        h = std::hash<std::string>()(tok->str());
+    }
+
+    const std::size_t h1 = expressionHash(op1);
+    const std::size_t h2 = expressionHash(op2);
+    if (op1 && op2 && Token::Match(tok, "%or%|%oror%|+|*|&|&&|^|==|!="))
+        return combineHash(h, h1 + h2);
+    return combineHash(combineHash(h, h1), h2);
+}
+
 bool isOppositeCond(bool isNot, bool cpp, const Token * const cond1, const Token * const cond2, const Library& library, bool pure)
 {
     if (!cond1 || !cond2)
@@ -418,6 +449,32 @@ bool isVariableChangedByFunctionCall(const Token *tok, const Settings *settings,
     return arg && !arg->isConst() && arg->isReference();
 }
 
+bool isVariableChangedHere(const Token *tok, const Settings *settings)
+{
+    if (Token::Match(tok, "%name% %assign%|++|--"))
+        return true;
+
+    if (Token::Match(tok->previous(), "++|-- %name%"))
+        return true;
+
+    const Token *ftok = tok;
+    while (ftok && !Token::Match(ftok, "[({[]"))
+        ftok = ftok->astParent();
+
+    if (ftok && Token::Match(ftok->link(), ") !!{")) {
+        bool inconclusive = false;
+        bool isChanged = isVariableChangedByFunctionCall(tok, settings, &inconclusive);
+        isChanged |= inconclusive;
+        if (isChanged)
+            return true;
+    }
+
+    const Token *parent = tok->astParent();
+    while (Token::Match(parent, ".|::"))
+        parent = parent->astParent();
+    return parent && parent->tokType() == Token::eIncDecOp;
+}
+
 bool isVariableChanged(const Token *start, const Token *end, const unsigned int varid, bool globalvar, const Settings *settings)
 {
     for (const Token *tok = start; tok != end; tok = tok->next()) {
@@ -428,28 +485,7 @@ bool isVariableChanged(const Token *start, const Token *end, const unsigned int
             continue;
         }
 
-        if (Token::Match(tok, "%name% %assign%|++|--"))
-            return true;
-
-        if (Token::Match(tok->previous(), "++|-- %name%"))
-            return true;
-
-        const Token *ftok = tok;
-        while (ftok && !Token::Match(ftok, "[({[]"))
-            ftok = ftok->astParent();
-
-        if (ftok && Token::Match(ftok->link(), ") !!{")) {
-            bool inconclusive = false;
-            bool isChanged = isVariableChangedByFunctionCall(tok, settings, &inconclusive);
-            isChanged |= inconclusive;
-            if (isChanged)
-                return true;
-        }
-
-        const Token *parent = tok->astParent();
-        while (Token::Match(parent, ".|::"))
-            parent = parent->astParent();
-        if (parent && parent->tokType() == Token::eIncDecOp)
+        if (isVariableChangedHere(tok, settings))
             return true;
     }
     return false;
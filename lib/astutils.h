@@ -22,6 +22,7 @@
 #define astutilsH
 //---------------------------------------------------------------------------
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -56,6 +57,13 @@ const Token * astIsVariableComparison(const Token *tok, const std::string &comp,
 
 bool isSameExpression(bool cpp, bool macro, const Token *tok1, const Token *tok2, const Library& library, bool pure);
 
+/**
+ * Structural hash of an expression. Expressions that isSameExpression() considers
+ * to be the same have the same hash, so it can be used to find candidates before
+ * comparing them.
+ */
+std::size_t expressionHash(const Token *tok);
+
 /**
  * Are two conditions opposite
  * @param isNot  do you want to know if cond1 is !cond2 or if cond1 and cond2 are non-overlapping. true: cond1==!cond2  false: cond1==true => cond2==false
@@ -84,7 +92,13 @@ bool isReturnScope(const Token *endToken);
  */
 bool isVariableChangedByFunctionCall(const Token *tok, const Settings *settings, bool *inconclusive);
 
-/** Is variable changed in block of code? */
+/** Is the variable at tok changed by the expression it is used in? */
+bool isVariableChangedHere(const Token *tok, const Settings *settings);
+
+/**
+ * Is variable changed in block of code? This walks the tokens, use
+ * TokenList::isVariableChanged() to look it up in the def-use index.
+ */
 bool isVariableChanged(const Token *start, const Token *end, const unsigned int varid, bool globalvar, const Settings *settings);
 
 /** Determines the number of arguments - if token is a function call or macro
@@ -20,10 +20,27 @@
 
 #include "check.h"
 
+#include <algorithm>
 #include <iostream>
 
 //---------------------------------------------------------------------------
 
+namespace {
+    /** Collects the ids and severities of the errors that getErrorMessages() lists */
+    class ErrorIdLogger : public ErrorLogger {
+    public:
+        virtual void reportOut(const std::string &outmsg) {
+            (void)outmsg;
+        }
+
+        virtual void reportErr(const ErrorLogger::ErrorMessage &msg) {
+            errors.push_back(std::make_pair(msg._id, msg._severity));
+        }
+
+        Check::ErrorIds errors;
+    };
+}
+
 Check::Check(const std::string &aname)
     : _tokenizer(0), _settings(0), _errorLogger(0), _name(aname)
 {
@@ -41,6 +58,44 @@ void Check::reportError(const ErrorLogger::ErrorMessage &errmsg)
     std::cout << errmsg.toXML(true, 1) << std::endl;
 }
 
+Check::ErrorIds Check::listedErrors(const Settings &settings) const
+{
+    // Some checks only list the errors that the settings enable
+    Settings all;
+    all.addEnabled("all");
+    all.inconclusive = true;
+    all.experimental = true;
+    all.checkLibrary = true;
+    all.library.functionwarn = settings.library.functionwarn;
+
+    ErrorIdLogger errorIds;
+    getErrorMessages(&errorIds, &all);
+    const ErrorIds unlisted = unlistedErrors();
+    errorIds.errors.insert(errorIds.errors.end(), unlisted.begin(), unlisted.end());
+    return errorIds.errors;
+}
+
+void Check::assertListed(const ErrorLogger::ErrorMessage &errmsg) const
+{
+#ifndef NDEBUG
+    // getErrorMessages() reports errors without a tokenizer
+    if (!_tokenizer || !_settings)
+        return;
+
+    for (std::list<Check *>::const_iterator it = instances().begin(); it != instances().end(); ++it) {
+        if ((*it)->name() != _name)
+            continue;
+        const ErrorIds listed = (*it)->listedErrors(*_settings);
+        if (std::find(listed.begin(), listed.end(), std::make_pair(errmsg._id, errmsg._severity)) == listed.end())
+            throw InternalError(nullptr, _name + " reports the error '" + errmsg._id + "' (" + Severity::toString(errmsg._severity) +
+                                ") that its getErrorMessages() and unlistedErrors() do not list.");
+        return;
+    }
+#else
+    (void)errmsg;
+#endif
+}
+
 bool Check::wrongData(const Token *tok, bool condition, const char *str)
 {
 #if defined(DACA2) || defined(UNSTABLE)
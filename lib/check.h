@@ -30,6 +30,10 @@
 
 #include <list>
 #include <string>
+#include <utility>
+#include <vector>
+
+class TokenTraversal;
 
 namespace tinyxml2 {
     class XMLElement;
@@ -70,9 +74,59 @@ public:
     /** run checks, the token list is simplified */
     virtual void runSimplifiedChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) = 0;
 
+    /**
+     * Does runSimplifiedChecks() do anything for the given tokenizer and settings?
+     * If no check needs it, the simplified token list is not created at all.
+     */
+    virtual bool needsSimplifiedTokens(const Tokenizer *tokenizer, const Settings *settings) const {
+        (void)tokenizer;
+        (void)settings;
+        return true;
+    }
+
+    /**
+     * Do runChecks() and runSimplifiedChecks() only look at one function
+     * scope at a time? Then --function-jobs gives each part of the checking
+     * a part of the function scopes. Other checks see all function scopes in
+     * the first part.
+     */
+    virtual bool canSplitFunctionScopes() const {
+        return false;
+    }
+
+    /**
+     * Add the visitors of this check to the traversal of the normal token
+     * list. CppCheck runs it once for all checks after runChecks().
+     */
+    virtual void addVisitors(TokenTraversal *traversal, const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) const {
+        (void)traversal;
+        (void)tokenizer;
+        (void)settings;
+        (void)errorLogger;
+    }
+
     /** get error messages */
     virtual void getErrorMessages(ErrorLogger *errorLogger, const Settings *settings) const = 0;
 
+    /** Ids and severities of errors */
+    typedef std::vector<std::pair<std::string, Severity::SeverityType> > ErrorIds;
+
+    /**
+     * Errors that are reported but that getErrorMessages() does not list:
+     * ids that another check lists, and ids that are also reported with
+     * another severity. The error list has no duplicate ids.
+     */
+    virtual ErrorIds unlistedErrors() const {
+        return ErrorIds();
+    }
+
+    /**
+     * The errors that getErrorMessages() lists when all errors are enabled
+     * and the unlistedErrors(). CppCheck does not run a check when none of
+     * these errors is enabled.
+     */
+    ErrorIds listedErrors(const Settings &settings) const;
+
     /** class name, used to generate documentation */
     const std::string& name() const {
         return _name;
@@ -147,6 +201,7 @@ protected:
     template<typename T, typename U>
     void reportError(const std::list<const Token *> &callstack, Severity::SeverityType severity, const T id, const U msg, const CWE &cwe, bool inconclusive) {
         const ErrorLogger::ErrorMessage errmsg(callstack, _tokenizer?&_tokenizer->list:0, severity, id, msg, cwe, inconclusive);
+        assertListed(errmsg);
         if (_errorLogger)
             _errorLogger->reportErr(errmsg);
         else
@@ -155,18 +210,27 @@ protected:
 
     void reportError(const ErrorPath &errorPath, Severity::SeverityType severity, const char id[], const std::string &msg, const CWE &cwe, bool inconclusive) {
         const ErrorLogger::ErrorMessage errmsg(errorPath, _tokenizer ? &_tokenizer->list : nullptr, severity, id, msg, cwe, inconclusive);
+        assertListed(errmsg);
         if (_errorLogger)
             _errorLogger->reportErr(errmsg);
         else
             reportError(errmsg);
     }
 
+    /**
+     * In debug builds, throw an InternalError if the id and severity of an
+     * error are not in listedErrors(). Otherwise the error could be lost
+     * when CppCheck does not run the check.
+     */
+    void assertListed(const ErrorLogger::ErrorMessage &errmsg) const;
+
     ErrorPath getErrorPath(const Token *errtok, const ValueFlow::Value *value, const std::string &bug) const {
         ErrorPath errorPath;
         if (!value) {
             errorPath.push_back(ErrorPathItem(errtok,bug));
         } else if (_settings->verbose || _settings->xml || _settings->outputFormat == "daca2") {
-            errorPath = value->errorPath;
+            for (ValueFlow::Value::ErrorPath::const_iterator it = value->errorPath.begin(); it != value->errorPath.end(); ++it)
+                errorPath.push_back(ErrorPathItem(it->tok, it->str()));
             errorPath.push_back(ErrorPathItem(errtok,bug));
         } else {
             if (value->condition)
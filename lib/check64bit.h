@@ -64,6 +64,15 @@ public:
         (void)errorLogger;
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *, const Settings *) const {
+        return false;
+    }
+
+    /** pointerassignment() looks at one function scope at a time */
+    bool canSplitFunctionScopes() const {
+        return true;
+    }
+
     /** Check for pointer assignment */
     void pointerassignment();
 
@@ -54,6 +54,10 @@ public:
         check.assertWithSideEffects();
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *, const Settings *settings) const {
+        return settings->isEnabled(Settings::WARNING);
+    }
+
     void assertWithSideEffects();
 
 protected:
@@ -61,6 +61,11 @@ public:
         checkAutoVariables.returnPointerToLocalArray();
     }
 
+    /** All checks loop over the function scopes and keep no state between them */
+    bool canSplitFunctionScopes() const {
+        return true;
+    }
+
     /** assign function argument */
     void assignFunctionArg();
 
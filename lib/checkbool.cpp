@@ -29,7 +29,7 @@
 #include "tokenize.h"
 
 #include <cstddef>
-#include <list>
+#include <deque>
 //---------------------------------------------------------------------------
 
 // Register this check class (by creating a static instance of it)
@@ -394,7 +394,7 @@ void CheckBool::pointerArithBool()
 {
     const SymbolDatabase* symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    for (std::list<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
+    for (std::deque<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
         if (scope->type != Scope::eIf && scope->type != Scope::eWhile && scope->type != Scope::eDo && scope->type != Scope::eFor)
             continue;
         const Token* tok = scope->classDef->next()->astOperand2();
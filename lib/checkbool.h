@@ -121,6 +121,7 @@ private:
         c.comparisonOfFuncReturningBoolError(nullptr, "func_name");
         c.comparisonOfTwoFuncsReturningBoolError(nullptr, "func_name1", "func_name2");
         c.comparisonOfBoolWithBoolError(nullptr, "var_name");
+        c.comparisonOfBoolWithInvalidComparator(nullptr, "expression");
         c.incrementBooleanError(nullptr);
         c.bitwiseOnBooleanError(nullptr, "varname", "&&");
         c.comparisonOfBoolExpressionWithIntError(nullptr, true);
@@ -58,6 +58,15 @@ public:
         checkBoost.checkBoostForeachModification();
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *tokenizer, const Settings *) const {
+        return tokenizer->isCPP();
+    }
+
+    /** The BOOST_FOREACH loops are searched for in the function scopes */
+    bool canSplitFunctionScopes() const {
+        return true;
+    }
+
     /** @brief %Check for container modification while using the BOOST_FOREACH macro */
     void checkBoostForeachModification();
 
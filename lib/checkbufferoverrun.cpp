@@ -1159,7 +1159,7 @@ void CheckBufferOverrun::checkGlobalAndLocalVariable()
             if (!value)
                 continue;
 
-            for (std::list<ValueFlow::Value>::const_iterator it = tok->values().begin(); it != tok->values().end(); ++it) {
+            for (std::vector<ValueFlow::Value>::const_iterator it = tok->values().begin(); it != tok->values().end(); ++it) {
                 if (!it->isTokValue() || !it->tokvalue)
                     continue;
                 const Variable *var = it->tokvalue->variable();
@@ -1195,13 +1195,13 @@ void CheckBufferOverrun::checkGlobalAndLocalVariable()
     }
 
     // check all known fixed size arrays first by just looking them up
-    for (std::list<Scope>::const_iterator scope = symbolDatabase->scopeList.cbegin(); scope != symbolDatabase->scopeList.cend(); ++scope) {
+    ProgressReporter progress1(_settings->reportProgress ? _errorLogger : nullptr,
+                               _tokenizer->list.getSourceFilePath(), "Check (BufferOverrun::checkGlobalAndLocalVariable 1)");
+    for (std::deque<Scope>::const_iterator scope = symbolDatabase->scopeList.cbegin(); scope != symbolDatabase->scopeList.cend(); ++scope) {
         std::map<unsigned int, ArrayInfo> arrayInfos;
         for (std::list<Variable>::const_iterator var = scope->varlist.cbegin(); var != scope->varlist.cend(); ++var) {
             if (var->isArray() && var->dimension(0) > 0) {
-                _errorLogger->reportProgress(_tokenizer->list.getSourceFilePath(),
-                                             "Check (BufferOverrun::checkGlobalAndLocalVariable 1)",
-                                             var->nameToken()->progressValue());
+                progress1.report(var->nameToken()->progressValue());
 
                 if (_tokenizer->isMaxTime())
                     return;
@@ -1230,6 +1230,8 @@ void CheckBufferOverrun::checkGlobalAndLocalVariable()
     const std::vector<const std::string*> v;
 
     // find all dynamically allocated arrays next
+    ProgressReporter progress2(_settings->reportProgress ? _errorLogger : nullptr,
+                               _tokenizer->list.getSourceFilePath(), "Check (BufferOverrun::checkGlobalAndLocalVariable 2)");
     const std::size_t functions = symbolDatabase->functionScopes.size();
     for (std::size_t i = 0; i < functions; ++i) {
         const Scope * scope = symbolDatabase->functionScopes[i];
@@ -1246,9 +1248,7 @@ void CheckBufferOverrun::checkGlobalAndLocalVariable()
             // nextTok : used to skip to next statement.
             const Token * nextTok = tok;
 
-            _errorLogger->reportProgress(_tokenizer->list.getSourceFilePath(),
-                                         "Check (BufferOverrun::checkGlobalAndLocalVariable 2)",
-                                         tok->progressValue());
+            progress2.report(tok->progressValue());
 
             if (_tokenizer->isMaxTime())
                 return;
@@ -95,7 +95,7 @@ void CheckClass::constructors()
         const Scope * scope = symbolDatabase->classAndStructScopes[i];
 
         bool usedInUnion = false;
-        for (std::list<Scope>::const_iterator it = symbolDatabase->scopeList.begin(); it != symbolDatabase->scopeList.end(); ++it) {
+        for (std::deque<Scope>::const_iterator it = symbolDatabase->scopeList.begin(); it != symbolDatabase->scopeList.end(); ++it) {
             if (it->type != Scope::eUnion)
                 continue;
             const Scope &unionScope = *it;
@@ -127,7 +127,7 @@ void CheckClass::constructors()
         // TODO: handle union variables better
         {
             bool bailout = false;
-            for (std::list<Scope *>::const_iterator it = scope->nestedList.begin(); it != scope->nestedList.end(); ++it) {
+            for (std::vector<Scope *>::const_iterator it = scope->nestedList.begin(); it != scope->nestedList.end(); ++it) {
                 const Scope * const nestedScope = *it;
                 if (nestedScope->type == Scope::eUnion) {
                     bailout = true;
@@ -933,7 +933,7 @@ static bool checkFunctionUsage(const Function *privfunc, const Scope* scope)
             return true;
     }
 
-    for (std::list<Type*>::const_iterator i = scope->definedTypes.begin(); i != scope->definedTypes.end(); ++i) {
+    for (std::vector<Type *>::const_iterator i = scope->definedTypes.begin(); i != scope->definedTypes.end(); ++i) {
         const Type *type = *i;
         if (type->enclosingScope == scope && checkFunctionUsage(privfunc, type->classScope))
             return true;
@@ -2220,7 +2220,7 @@ void CheckClass::checkPureVirtualFunctionCall()
             pureFuncStack.push_back(&pureCall);
             getFirstPureVirtualFunctionCallStack(callsPureVirtualFunctionMap, pureCall, pureFuncStack);
             if (!pureFuncStack.empty())
-                callsPureVirtualFunctionError(*scope->function, pureFuncStack, pureFuncStack.back()->str());
+                callsPureVirtualFunctionError(scope->function, pureFuncStack, pureFuncStack.back()->str());
         }
     }
 }
@@ -2306,11 +2306,11 @@ void CheckClass::getFirstPureVirtualFunctionCallStack(
 }
 
 void CheckClass::callsPureVirtualFunctionError(
-    const Function & scopeFunction,
+    const Function * scopeFunction,
     const std::list<const Token *> & tokStack,
     const std::string &purefuncname)
 {
-    const char * scopeFunctionTypeName = getFunctionTypeName(scopeFunction.type);
+    const char * scopeFunctionTypeName = scopeFunction ? getFunctionTypeName(scopeFunction->type) : "constructor";
     reportError(tokStack, Severity::warning, "pureVirtualCall", "Call of pure virtual function '" + purefuncname + "' in " + scopeFunctionTypeName + ".\n"
                 "Call of pure virtual function '" + purefuncname + "' in " + scopeFunctionTypeName + ". The call will fail during runtime.", CWE(0U), false);
 }
@@ -2326,7 +2326,7 @@ void CheckClass::checkDuplInheritedMembers()
         return;
 
     // Iterate over all classes
-    for (std::list<Type>::const_iterator classIt = symbolDatabase->typeList.begin();
+    for (std::deque<Type>::const_iterator classIt = symbolDatabase->typeList.begin();
          classIt != symbolDatabase->typeList.end();
          ++classIt) {
         // Iterate over the parent classes
@@ -91,6 +91,10 @@ public:
         checkClass.checkCopyCtorAndEqOperator();
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *tokenizer, const Settings *) const {
+        return !tokenizer->isC();
+    }
+
 
     /** @brief %Check that all class constructors are ok */
     void constructors();
@@ -180,7 +184,7 @@ private:
     void initializerListError(const Token *tok1,const Token *tok2, const std::string & classname, const std::string &varname);
     void suggestInitializationList(const Token *tok, const std::string& varname);
     void selfInitializationError(const Token* tok, const std::string& varname);
-    void callsPureVirtualFunctionError(const Function & scopeFunction, const std::list<const Token *> & tokStack, const std::string &purefuncname);
+    void callsPureVirtualFunctionError(const Function * scopeFunction, const std::list<const Token *> & tokStack, const std::string &purefuncname);
     void duplInheritedMembersError(const Token* tok1, const Token* tok2, const std::string &derivedname, const std::string &basename, const std::string &variablename, bool derivedIsStruct, bool baseIsStruct);
     void copyCtorAndEqOperatorError(const Token *tok, const std::string &classname, bool isStruct, bool hasCopyCtor);
 
@@ -213,6 +217,12 @@ private:
         c.selfInitializationError(nullptr, "var");
         c.duplInheritedMembersError(nullptr, 0, "class", "class", "variable", false, false);
         c.copyCtorAndEqOperatorError(nullptr, "class", false, false);
+        c.callsPureVirtualFunctionError(nullptr, std::list<const Token *>(), "f");
+    }
+
+    /** A base class without a virtual destructor and with virtual members is a warning */
+    ErrorIds unlistedErrors() const {
+        return ErrorIds(1, std::make_pair("virtualDestructor", Severity::warning));
     }
 
     static std::string myName() {
@@ -32,11 +32,15 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <deque>
+#include <vector>
 #include <limits>
 #include <list>
+#include <map>
 #include <ostream>
 #include <set>
 #include <stack>
+#include <unordered_map>
 #include <utility>
 
 // CWE ids used
@@ -57,10 +61,9 @@ void CheckCondition::assignIf()
     if (!_settings->isEnabled(Settings::STYLE))
         return;
 
-    for (const Token *tok = _tokenizer->tokens(); tok; tok = tok->next()) {
-        if (tok->str() != "=")
-            continue;
-
+    const std::vector<const Token *> &assignments = _tokenizer->list.tokensWithStr("=");
+    for (std::size_t i = 0; i < assignments.size(); ++i) {
+        const Token *tok = assignments[i];
         if (Token::Match(tok->tokAt(-2), "[;{}] %var% =")) {
             const Variable *var = tok->previous()->variable();
             if (var == 0)
@@ -160,7 +163,7 @@ bool CheckCondition::assignIfParseScope(const Token * const assignTok,
                 // is variable changed in loop?
                 const Token *bodyStart = tok2->linkAt(1)->next();
                 const Token *bodyEnd   = bodyStart ? bodyStart->link() : nullptr;
-                if (!bodyEnd || bodyEnd->str() != "}" || isVariableChanged(bodyStart, bodyEnd, varid, !islocal, _settings))
+                if (!bodyEnd || bodyEnd->str() != "}" || _tokenizer->list.isVariableChanged(bodyStart, bodyEnd, varid, !islocal))
                     continue;
             }
 
@@ -402,6 +405,71 @@ bool CheckCondition::isOverlappingCond(const Token * const cond1, const Token *
 }
 
 
+/** Operand of a '&' or '==' condition that is compared against a number, see isOverlappingCond() */
+static const Token *bitOverlapOperand(const Token *cond)
+{
+    if (!Token::Match(cond, "&|==") || !cond->astOperand1() || !cond->astOperand2())
+        return nullptr;
+    const Token *expr = cond->astOperand1();
+    const Token *num = cond->astOperand2();
+    if (!num->isNumber())
+        std::swap(expr, num);
+    if (!num->isNumber() || MathLib::isNegative(num->str()))
+        return nullptr;
+    return expr;
+}
+
+namespace {
+    /** Conditions of an if / else if chain, indexed by expression hash */
+    struct ElseIfChain {
+        std::vector<const Token *> parens;
+        std::unordered_map<std::size_t, std::vector<std::size_t> > sameHash;
+        std::unordered_map<std::size_t, std::vector<std::size_t> > bitHash;
+
+        const Token *condition(std::size_t pos) const {
+            return parens[pos]->astOperand2();
+        }
+
+        void add(const Token *paren) {
+            const std::size_t pos = parens.size();
+            parens.push_back(paren);
+            const Token *cond = paren->astOperand2();
+            if (!cond)
+                return;
+            sameHash[expressionHash(cond)].push_back(pos);
+            const Token *expr = bitOverlapOperand(cond);
+            if (expr)
+                bitHash[expressionHash(expr)].push_back(pos);
+        }
+
+        /** positions after pos that might overlap with the condition at pos, in ascending order */
+        std::vector<std::size_t> candidates(std::size_t pos) const {
+            std::vector<std::size_t> ret;
+            const Token *cond = condition(pos);
+            if (!cond)
+                return ret;
+            append(sameHash, expressionHash(cond), pos, &ret);
+            if (cond->str() == "&") {
+                const Token *expr = bitOverlapOperand(cond);
+                if (expr) {
+                    append(bitHash, expressionHash(expr), pos, &ret);
+                    std::sort(ret.begin(), ret.end());
+                    ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+                }
+            }
+            return ret;
+        }
+
+    private:
+        static void append(const std::unordered_map<std::size_t, std::vector<std::size_t> > &index, std::size_t hash, std::size_t pos, std::vector<std::size_t> *ret) {
+            const std::unordered_map<std::size_t, std::vector<std::size_t> >::const_iterator it = index.find(hash);
+            if (it == index.end())
+                return;
+            ret->insert(ret->end(), std::upper_bound(it->second.begin(), it->second.end(), pos), it->second.end());
+        }
+    };
+}
+
 void CheckCondition::multiCondition()
 {
     if (!_settings->isEnabled(Settings::STYLE))
@@ -409,22 +477,40 @@ void CheckCondition::multiCondition()
 
     const SymbolDatabase* const symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
+    // Long else if chains are compared through hashed conditions instead of
+    // comparing every condition with every following condition.
+    std::list<ElseIfChain> chains;
+    std::map<const Token *, std::pair<const ElseIfChain *, std::size_t> > chainPos;
+
+    for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
         if (i->type != Scope::eIf)
             continue;
 
-        const Token * const cond1 = i->classDef->next()->astOperand2();
-
-        const Token * tok2 = i->classDef->next();
-        for (;;) {
-            tok2 = tok2->link();
-            if (!Token::simpleMatch(tok2, ") {"))
-                break;
-            tok2 = tok2->linkAt(1);
-            if (!Token::simpleMatch(tok2, "} else { if ("))
-                break;
-            tok2 = tok2->tokAt(4);
+        std::map<const Token *, std::pair<const ElseIfChain *, std::size_t> >::const_iterator it = chainPos.find(i->classDef->next());
+        if (it == chainPos.end()) {
+            chains.push_back(ElseIfChain());
+            ElseIfChain &chain = chains.back();
+            const Token * tok2 = i->classDef->next();
+            for (;;) {
+                chainPos[tok2] = std::make_pair(&chain, chain.parens.size());
+                chain.add(tok2);
+                tok2 = tok2->link();
+                if (!Token::simpleMatch(tok2, ") {"))
+                    break;
+                tok2 = tok2->linkAt(1);
+                if (!Token::simpleMatch(tok2, "} else { if ("))
+                    break;
+                tok2 = tok2->tokAt(4);
+            }
+            it = chainPos.find(i->classDef->next());
+        }
 
+        const ElseIfChain &chain = *it->second.first;
+        const std::size_t pos = it->second.second;
+        const Token * const cond1 = chain.condition(pos);
+        const std::vector<std::size_t> candidates = chain.candidates(pos);
+        for (std::size_t c = 0; c < candidates.size(); ++c) {
+            const Token * const tok2 = chain.parens[candidates[c]];
             if (isOverlappingCond(cond1, tok2->astOperand2(), true))
                 multiConditionError(tok2, cond1->linenr());
         }
@@ -451,7 +537,7 @@ void CheckCondition::oppositeInnerCondition()
 
     const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    for (std::list<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
+    for (std::deque<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
         if (scope->type != Scope::eIf)
             continue;
 
@@ -70,6 +70,10 @@ public:
         checkCondition.checkModuloAlwaysTrueFalse();
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *, const Settings *settings) const {
+        return settings->isEnabled(Settings::STYLE) || settings->isEnabled(Settings::WARNING);
+    }
+
     /** mismatching assignment / comparison */
     void assignIf();
 
@@ -75,6 +75,10 @@ public:
         checkExceptionSafety.unhandledExceptionSpecification();
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *tokenizer, const Settings *) const {
+        return !tokenizer->isC();
+    }
+
     /** Don't throw exceptions in destructors */
     void destructors();
 
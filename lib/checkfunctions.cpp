@@ -63,19 +63,8 @@ void CheckFunctions::checkProhibitedFunctions()
                 continue;
             // alloca() is special as it depends on the code being C or C++, so it is not in Library
             if (checkAlloca && Token::simpleMatch(tok, "alloca (") && (!tok->function() || tok->function()->nestedIn->type == Scope::eGlobal)) {
-                if (_tokenizer->isC()) {
-                    if (_settings->standards.c > Standards::C89)
-                        reportError(tok, Severity::warning, "allocaCalled",
-                                    "Obsolete function 'alloca' called. In C99 and later it is recommended to use a variable length array instead.\n"
-                                    "The obsolete function 'alloca' is called. In C99 and later it is recommended to use a variable length array or "
-                                    "a dynamically allocated array instead. The function 'alloca' is dangerous for many reasons "
-                                    "(http://stackoverflow.com/questions/1018853/why-is-alloca-not-considered-good-practice and http://linux.die.net/man/3/alloca).");
-                } else
-                    reportError(tok, Severity::warning, "allocaCalled",
-                                "Obsolete function 'alloca' called.\n"
-                                "The obsolete function 'alloca' is called. In C++11 and later it is recommended to use std::array<> or "
-                                "a dynamically allocated array instead. The function 'alloca' is dangerous for many reasons "
-                                "(http://stackoverflow.com/questions/1018853/why-is-alloca-not-considered-good-practice and http://linux.die.net/man/3/alloca).");
+                if (!_tokenizer->isC() || _settings->standards.c > Standards::C89)
+                    allocaCalledError(tok);
             } else {
                 if (tok->function() && tok->function()->hasBody())
                     continue;
@@ -91,6 +80,22 @@ void CheckFunctions::checkProhibitedFunctions()
     }
 }
 
+void CheckFunctions::allocaCalledError(const Token *tok)
+{
+    if (_tokenizer && _tokenizer->isC())
+        reportError(tok, Severity::warning, "allocaCalled",
+                    "Obsolete function 'alloca' called. In C99 and later it is recommended to use a variable length array instead.\n"
+                    "The obsolete function 'alloca' is called. In C99 and later it is recommended to use a variable length array or "
+                    "a dynamically allocated array instead. The function 'alloca' is dangerous for many reasons "
+                    "(http://stackoverflow.com/questions/1018853/why-is-alloca-not-considered-good-practice and http://linux.die.net/man/3/alloca).");
+    else
+        reportError(tok, Severity::warning, "allocaCalled",
+                    "Obsolete function 'alloca' called.\n"
+                    "The obsolete function 'alloca' is called. In C++11 and later it is recommended to use std::array<> or "
+                    "a dynamically allocated array instead. The function 'alloca' is dangerous for many reasons "
+                    "(http://stackoverflow.com/questions/1018853/why-is-alloca-not-considered-good-practice and http://linux.die.net/man/3/alloca).");
+}
+
 //---------------------------------------------------------------------------
 // Check <valid> and <not-bool>
 //---------------------------------------------------------------------------
@@ -424,10 +429,15 @@ void CheckFunctions::checkLibraryMatchFunctions()
             !Token::simpleMatch(tok->astParent(), "new") &&
             tok->astParent() == tok->next() &&
             _settings->library.isNotLibraryFunction(tok)) {
-            reportError(tok,
-                        Severity::information,
-                        "checkLibraryFunction",
-                        "--check-library: There is no matching configuration for function " + tok->str() + "()");
+            checkLibraryFunctionError(tok, tok->str());
         }
     }
 }
+
+void CheckFunctions::checkLibraryFunctionError(const Token *tok, const std::string &functionName)
+{
+    reportError(tok,
+                Severity::information,
+                "checkLibraryFunction",
+                "--check-library: There is no matching configuration for function " + functionName + "()");
+}
@@ -116,12 +116,14 @@ private:
     void memsetZeroBytesError(const Token *tok);
     void memsetFloatError(const Token *tok, const std::string &var_value);
     void memsetValueOutOfRangeError(const Token *tok, const std::string &value);
+    void allocaCalledError(const Token *tok);
+    void checkLibraryFunctionError(const Token *tok, const std::string &functionName);
 
     void getErrorMessages(ErrorLogger *errorLogger, const Settings *settings) const {
         CheckFunctions c(nullptr, settings, errorLogger);
 
         for (std::map<std::string, Library::WarnInfo>::const_iterator i = settings->library.functionwarn.cbegin(); i != settings->library.functionwarn.cend(); ++i) {
-            c.reportError(nullptr, Severity::style, i->first+"Called", i->second.message);
+            c.reportError(nullptr, i->second.severity, i->first+"Called", i->second.message);
         }
 
         c.invalidFunctionArgError(nullptr, "func_name", 1, nullptr,"1:4");
@@ -132,6 +134,8 @@ private:
         c.memsetZeroBytesError(nullptr);
         c.memsetFloatError(nullptr,  "varname");
         c.memsetValueOutOfRangeError(nullptr,  "varname");
+        c.allocaCalledError(nullptr);
+        c.checkLibraryFunctionError(nullptr, "func_name");
     }
 
     static std::string myName() {
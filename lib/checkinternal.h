@@ -59,6 +59,10 @@ public:
         checkInternal.checkRedundantTokCheck();
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *, const Settings *settings) const {
+        return settings->isEnabled(Settings::INTERNAL);
+    }
+
     /** @brief %Check if a simple pattern is used inside Token::Match or Token::findmatch */
     void checkTokenMatchPatterns();
 
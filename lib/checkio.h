@@ -164,9 +164,25 @@ private:
         c.invalidPrintfArgTypeError_float(nullptr,  1, "f", nullptr);
         c.invalidLengthModifierError(nullptr,  1, "I");
         c.invalidScanfFormatWidthError(nullptr,  10, 5, nullptr, 's');
+        c.invalidScanfFormatWidthError(nullptr,  10, -1, nullptr, 's');
         c.wrongPrintfScanfPosixParameterPositionError(nullptr,  "printf", 2, 1);
     }
 
+    /** The argument type errors are portability errors for typedefs */
+    ErrorIds unlistedErrors() const {
+        static const char * const argTypeIds[] = {
+            "invalidScanfArgType_s", "invalidScanfArgType_int", "invalidScanfArgType_float",
+            "invalidPrintfArgType_s", "invalidPrintfArgType_n", "invalidPrintfArgType_p",
+            "invalidPrintfArgType_int", "invalidPrintfArgType_uint", "invalidPrintfArgType_sint",
+            "invalidPrintfArgType_float"
+        };
+        ErrorIds errors;
+        for (std::size_t i = 0; i < sizeof(argTypeIds) / sizeof(argTypeIds[0]); ++i)
+            errors.push_back(std::make_pair(argTypeIds[i], Severity::portability));
+        errors.push_back(std::make_pair("wrongPrintfScanfArgNum", Severity::warning));
+        return errors;
+    }
+
     static std::string myName() {
         return "IO using format string";
     }
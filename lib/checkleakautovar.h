@@ -101,6 +101,11 @@ public:
         checkLeakAutoVar.check();
     }
 
+    /** Each function scope is checked with its own VarInfo */
+    bool canSplitFunctionScopes() const {
+        return true;
+    }
+
 private:
 
     /** check for leaks in all scopes */
@@ -139,6 +144,15 @@ private:
         c.doubleFreeError(nullptr, "varname", 0);
     }
 
+    ErrorIds unlistedErrors() const {
+        ErrorIds errors;
+        errors.push_back(std::make_pair("memleak", Severity::error));
+        errors.push_back(std::make_pair("resourceLeak", Severity::error));
+        errors.push_back(std::make_pair("mismatchAllocDealloc", Severity::error));
+        errors.push_back(std::make_pair("deallocuse", Severity::error));
+        return errors;
+    }
+
     static std::string myName() {
         return "Leaks (auto variables)";
     }
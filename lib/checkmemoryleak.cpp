@@ -35,6 +35,7 @@
 #include <cstddef>
 #include <set>
 #include <stack>
+#include <vector>
 
 //---------------------------------------------------------------------------
 
@@ -2120,6 +2121,55 @@ void CheckMemoryLeakInFunction::checkScope(const Token *startTok, const std::str
 }
 //---------------------------------------------------------------------------
 
+std::vector<bool> CheckMemoryLeakInFunction::allocatedVariables() const
+{
+    std::vector<bool> allocated(symbolDatabase->getVariableListSize(), false);
+
+    for (const Token *tok = _tokenizer->tokens(); tok; tok = tok->next()) {
+        // fcloseall() deallocates all files without naming them
+        if (tok->str() == "fcloseall") {
+            allocated.assign(allocated.size(), true);
+            break;
+        }
+
+        const unsigned int varid = tok->varId();
+        if (varid == 0 || varid >= allocated.size() || allocated[varid])
+            continue;
+
+        // Allocation, reallocation or closing assignment
+        if (tok->strAt(1) == "=") {
+            const Token *rhs = tok->tokAt(2);
+            allocated[varid] = Token::simpleMatch(rhs, "close (") ||
+                               getAllocationType(rhs, varid) != No ||
+                               getReallocationType(rhs, varid) != No;
+        }
+
+        // The address is passed to a function that may allocate, or the variable is deleted
+        else if (Token::Match(tok->previous(), "&|delete|]")) {
+            allocated[varid] = true;
+        }
+
+        // The variable is passed to a function that may deallocate it
+        else if (Token::Match(tok->previous(), "(|,")) {
+            const Token *parent = tok->astParent();
+            while (Token::Match(parent, ",|-"))
+                parent = parent->astParent();
+            if (!parent || parent->str() == "delete")
+                allocated[varid] = true;
+            else if (parent->str() == "(") {
+                const Token *functok = parent->previous();
+                allocated[varid] = !functok || !functok->isName() || functok->function() ||
+                                   Token::Match(functok, "close|pclose|fclose|closedir|delete") ||
+                                   getDeallocationType(functok, varid) != No ||
+                                   getReallocationType(functok, varid) != No;
+            }
+        }
+    }
+
+    return allocated;
+}
+//---------------------------------------------------------------------------
+
 
 //---------------------------------------------------------------------------
 // Check for memory leaks due to improper realloc() usage.
@@ -2210,7 +2260,11 @@ void CheckMemoryLeakInFunction::check()
     }
 
     // Check variables..
+    const std::vector<bool> allocated = allocatedVariables();
     for (unsigned int i = 1; i < symbolDatabase->getVariableListSize(); i++) {
+        if (!allocated[i])
+            continue;
+
         const Variable* var = symbolDatabase->getVariableFromVarId(i);
         if (!var || (!var->isLocal() && !var->isArgument()) || var->isStatic() || !var->scope())
             continue;
@@ -39,6 +39,7 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 class Function;
 class Scope;
@@ -276,6 +277,15 @@ public:
 
     static const Token *findleak(const Token *tokens);
 
+    /**
+     * Find the variables that getcode() can return "alloc", "realloc" or
+     * "dealloc" for, in one pass over the token list. The other variables
+     * are neither leaked nor deallocated so checkScope() is not called for
+     * them.
+     * @return element varid is true for the variables that must be checked
+     */
+    std::vector<bool> allocatedVariables() const;
+
     /**
      * Checking the variable varname
      * @param startTok start token
@@ -344,6 +354,10 @@ public:
         checkMemoryLeak.check();
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *tokenizr, const Settings *) const {
+        return tokenizr->isCPP();
+    }
+
     void check();
 
 private:
@@ -361,6 +375,12 @@ private:
         c.unsafeClassError(0, "class", "class::varname");
     }
 
+    ErrorIds unlistedErrors() const {
+        ErrorIds errors;
+        errors.push_back(std::make_pair("mismatchAllocDealloc", Severity::error));
+        return errors;
+    }
+
     static std::string myName() {
         return "Memory leaks (class variables)";
     }
@@ -400,6 +420,13 @@ private:
     void getErrorMessages(ErrorLogger * /*errorLogger*/, const Settings * /*settings*/) const {
     }
 
+    ErrorIds unlistedErrors() const {
+        ErrorIds errors;
+        errors.push_back(std::make_pair("memleak", Severity::error));
+        errors.push_back(std::make_pair("resourceLeak", Severity::error));
+        return errors;
+    }
+
     static std::string myName() {
         return "Memory leaks (struct members)";
     }
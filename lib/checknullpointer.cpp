@@ -261,7 +261,7 @@ void CheckNullPointer::nullPointerLinkedList()
     //        if (tok->str() == "hello")
     //            tok = tok->next;   // <- tok might become a null pointer!
     //    }
-    for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
+    for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
         const Token* const tok1 = i->classDef;
         // search for a "for" scope..
         if (i->type != Scope::eFor || !tok1)
@@ -285,7 +285,7 @@ void CheckNullPointer::nullPointerLinkedList()
 
                 // Check usage of dereferenced variable in the loop..
                 // TODO: Move this to ValueFlow
-                for (std::list<Scope*>::const_iterator j = i->nestedList.begin(); j != i->nestedList.end(); ++j) {
+                for (std::vector<Scope *>::const_iterator j = i->nestedList.begin(); j != i->nestedList.end(); ++j) {
                     const Scope* const scope = *j;
                     if (scope->type != Scope::eWhile)
                         continue;
@@ -529,22 +529,30 @@ void CheckNullPointer::arithmetic()
 
 void CheckNullPointer::arithmeticError(const Token *tok, const ValueFlow::Value *value)
 {
-    std::string errmsg;
-    if (value && value->condition)
-        errmsg = ValueFlow::eitherTheConditionIsRedundant(value->condition) + " or there is overflow in pointer subtraction.";
-    else
-        errmsg = "Overflow in pointer arithmetic, NULL pointer is subtracted.";
+    if (value && value->condition) {
+        arithmeticRedundantCheckError(tok, value->condition, value->inconclusive);
+        return;
+    }
+
+    reportError(tok,
+                Severity::error,
+                "nullPointerArithmetic",
+                "Overflow in pointer arithmetic, NULL pointer is subtracted.",
+                CWE682, // unknown - pointer overflow
+                value && value->inconclusive);
+}
 
+void CheckNullPointer::arithmeticRedundantCheckError(const Token *tok, const Token *condition, bool inconclusive)
+{
     std::list<const Token*> callstack;
     callstack.push_back(tok);
-    if (value && value->condition)
-        callstack.push_back(value->condition);
+    callstack.push_back(condition);
 
     reportError(callstack,
-                (value && value->condition) ? Severity::warning : Severity::error,
-                (value && value->condition) ? "nullPointerArithmeticRedundantCheck" : "nullPointerArithmetic",
-                errmsg,
+                Severity::warning,
+                "nullPointerArithmeticRedundantCheck",
+                ValueFlow::eitherTheConditionIsRedundant(condition) + " or there is overflow in pointer subtraction.",
                 CWE682, // unknown - pointer overflow
-                value && value->inconclusive);
+                inconclusive);
 }
 
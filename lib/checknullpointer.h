@@ -106,9 +106,15 @@ private:
         CheckNullPointer c(nullptr, settings, errorLogger);
         c.nullPointerError(nullptr, "pointer", nullptr, false);
         c.arithmeticError(nullptr, nullptr);
+        c.arithmeticRedundantCheckError(nullptr, nullptr, false);
     }
 
     /** Name of check */
+    /** Possible null pointer dereferences are warnings */
+    ErrorIds unlistedErrors() const {
+        return ErrorIds(1, std::make_pair("nullPointer", Severity::warning));
+    }
+
     static std::string myName() {
         return "Null pointer";
     }
@@ -135,6 +141,7 @@ private:
     /** undefined null pointer arithmetic */
     void arithmetic();
     void arithmeticError(const Token *tok, const ValueFlow::Value *value);
+    void arithmeticRedundantCheckError(const Token *tok, const Token *condition, bool inconclusive);
 };
 /// @}
 //---------------------------------------------------------------------------
@@ -29,9 +29,11 @@
 #include "symboldatabase.h"
 #include "token.h"
 #include "tokenize.h"
+#include "tokenvisitor.h"
 #include "utils.h"
 
 #include <algorithm> // find_if()
+#include <deque>
 #include <list>
 #include <map>
 #include <ostream>
@@ -45,6 +47,49 @@ namespace {
     CheckOther instance;
 }
 
+namespace {
+    /** Calls a CheckOther function that looks at one token for each token it subscribed to */
+    class CheckOtherVisitor : public TokenVisitor {
+    public:
+        typedef void (CheckOther::*Function)(const Token *);
+
+        CheckOtherVisitor(const std::string &name, Function function, const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger)
+            : TokenVisitor(name), _checkOther(tokenizer, settings, errorLogger), _function(function) {
+        }
+
+        void visitToken(const Token *tok) {
+            (_checkOther.*_function)(tok);
+        }
+
+    private:
+        CheckOther _checkOther;
+        Function _function;
+    };
+}
+
+void CheckOther::addVisitors(TokenTraversal *traversal, const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) const
+{
+    TokenVisitor *visitor = new CheckOtherVisitor("Other::checkNanInArithmeticExpression", &CheckOther::checkNanInArithmeticExpression, tokenizer, settings, errorLogger);
+    visitor->subscribeTokens(Token::eArithmeticalOp);
+    traversal->add(visitor);
+
+    if (settings->isEnabled(Settings::STYLE)) {
+        visitor = new CheckOtherVisitor("Other::checkRedundantPointerOp", &CheckOther::checkRedundantPointerOp, tokenizer, settings, errorLogger);
+        visitor->subscribeAstOperators(Token::eBitOp);
+        traversal->add(visitor);
+    }
+
+    visitor = new CheckOtherVisitor("Other::checkZeroDivision", &CheckOther::checkZeroDivision, tokenizer, settings, errorLogger);
+    visitor->subscribeAstOperators(Token::eArithmeticalOp);
+    visitor->subscribeAstOperators(Token::eAssignmentOp);
+    traversal->add(visitor);
+
+    visitor = new CheckOtherVisitor("Other::checkNegativeBitwiseShift", &CheckOther::checkNegativeBitwiseShift, tokenizer, settings, errorLogger);
+    visitor->subscribeAstOperators(Token::eArithmeticalOp);
+    visitor->subscribeAstOperators(Token::eAssignmentOp);
+    traversal->add(visitor);
+}
+
 static const struct CWE CWE128(128U);   // Wrap-around Error
 static const struct CWE CWE131(131U);   // Incorrect Calculation of Buffer Size
 static const struct CWE CWE197(197U);   // Numeric Truncation Error
@@ -245,7 +290,7 @@ void CheckOther::checkSuspiciousSemicolon()
     const SymbolDatabase* const symbolDatabase = _tokenizer->getSymbolDatabase();
 
     // Look for "if(); {}", "for(); {}" or "while(); {}"
-    for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
+    for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
         if (i->type == Scope::eIf || i->type == Scope::eElse || i->type == Scope::eWhile || i->type == Scope::eFor) {
             // Ensure the semicolon is at the same line number as the if/for/while statement
             // and the {..} block follows it without an extra empty line.
@@ -489,7 +534,7 @@ void CheckOther::checkRedundantAssignment()
     const bool printInconclusive = _settings->inconclusive;
     const SymbolDatabase* symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    for (std::list<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
+    for (std::deque<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
         if (!scope->isExecutable())
             continue;
 
@@ -769,7 +814,7 @@ void CheckOther::checkRedundantAssignmentInSwitch()
 
     // Find the beginning of a switch. E.g.:
     //   switch (var) { ...
-    for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
+    for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
         if (i->type != Scope::eSwitch || !i->classStart)
             continue;
 
@@ -892,7 +937,7 @@ void CheckOther::checkSuspiciousCaseInSwitch()
 
     const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
+    for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
         if (i->type != Scope::eSwitch)
             continue;
 
@@ -1187,7 +1232,7 @@ bool CheckOther::checkInnerScope(const Token *tok, const Variable* var, bool& us
     } else if (loopVariable && tok->strAt(-1) == ")") {
         tok = tok->linkAt(-1); // Jump to opening ( of for/while statement
     } else if (scope->type == Scope::eSwitch) {
-        for (std::list<Scope*>::const_iterator i = scope->nestedList.begin(); i != scope->nestedList.end(); ++i) {
+        for (std::vector<Scope *>::const_iterator i = scope->nestedList.begin(); i != scope->nestedList.end(); ++i) {
             if (used) {
                 bool used2 = false;
                 if (!checkInnerScope((*i)->classStart, var, used2) || used2) {
@@ -1635,29 +1680,27 @@ void CheckOther::constStatementError(const Token *tok, const std::string &type)
 //---------------------------------------------------------------------------
 // Detect division by zero.
 //---------------------------------------------------------------------------
-void CheckOther::checkZeroDivision()
+void CheckOther::checkZeroDivision(const Token *tok)
 {
-    for (const Token *tok = _tokenizer->tokens(); tok; tok = tok->next()) {
-        if (!tok->astOperand2() || !tok->astOperand1())
-            continue;
-        if (tok->str() != "%" && tok->str() != "/" && tok->str() != "%=" && tok->str() != "/=")
-            continue;
-        if (!tok->valueType() || !tok->valueType()->isIntegral())
-            continue;
-        if (tok->astOperand1()->isNumber()) {
-            if (MathLib::isFloat(tok->astOperand1()->str()))
-                continue;
-        } else if (tok->astOperand1()->isName()) {
-            if (!tok->astOperand1()->valueType()->isIntegral())
-                continue;
-        } else if (!tok->astOperand1()->isArithmeticalOp())
-            continue;
+    if (!tok->astOperand2() || !tok->astOperand1())
+        return;
+    if (tok->str() != "%" && tok->str() != "/" && tok->str() != "%=" && tok->str() != "/=")
+        return;
+    if (!tok->valueType() || !tok->valueType()->isIntegral())
+        return;
+    if (tok->astOperand1()->isNumber()) {
+        if (MathLib::isFloat(tok->astOperand1()->str()))
+            return;
+    } else if (tok->astOperand1()->isName()) {
+        if (!tok->astOperand1()->valueType()->isIntegral())
+            return;
+    } else if (!tok->astOperand1()->isArithmeticalOp())
+        return;
 
-        // Value flow..
-        const ValueFlow::Value *value = tok->astOperand2()->getValue(0LL);
-        if (value && _settings->isEnabled(value, false))
-            zerodivError(tok, value);
-    }
+    // Value flow..
+    const ValueFlow::Value *value = tok->astOperand2()->getValue(0LL);
+    if (value && _settings->isEnabled(value, false))
+        zerodivError(tok, value);
 }
 
 void CheckOther::zerodivError(const Token *tok, const ValueFlow::Value *value)
@@ -1688,14 +1731,14 @@ void CheckOther::zerodivError(const Token *tok, const ValueFlow::Value *value)
 // double d = 1.0 / 0.0 + 100.0;
 //---------------------------------------------------------------------------
 
-void CheckOther::checkNanInArithmeticExpression()
+void CheckOther::checkNanInArithmeticExpression(const Token *tok)
 {
-    for (const Token *tok = _tokenizer->tokens(); tok; tok = tok->next()) {
-        if (Token::Match(tok, "inf.0 +|-") ||
-            Token::Match(tok, "+|- inf.0") ||
-            Token::Match(tok, "+|- %num% / 0.0")) {
-            nanInArithmeticExpressionError(tok);
-        }
+    // tok is an arithmetical operator
+    if (Token::Match(tok->previous(), "inf.0 +|-"))
+        nanInArithmeticExpressionError(tok->previous());
+    if (Token::Match(tok, "+|- inf.0") ||
+        Token::Match(tok, "+|- %num% / 0.0")) {
+        nanInArithmeticExpressionError(tok);
     }
 }
 
@@ -1747,6 +1790,19 @@ void CheckOther::misusedScopeObjectError(const Token *tok, const std::string& va
 // check for duplicate code in if and else branches
 // if (a) { b = true; } else { b = true; }
 //-----------------------------------------------------------------------------
+static bool isSameCode(const Token *tok1, const Token *end1, const Token *tok2, const Token *end2)
+{
+    for (; tok1 != end1 && tok2 != end2; tok1 = tok1->next(), tok2 = tok2->next()) {
+        if (tok1->str() != tok2->str() ||
+            tok1->isUnsigned() != tok2->isUnsigned() ||
+            tok1->isSigned() != tok2->isSigned() ||
+            tok1->isComplex() != tok2->isComplex() ||
+            tok1->isLong() != tok2->isLong())
+            return false;
+    }
+    return tok1 == end1 && tok2 == end2;
+}
+
 void CheckOther::checkDuplicateBranch()
 {
     // This is inconclusive since in practice most warnings are noise:
@@ -1762,7 +1818,7 @@ void CheckOther::checkDuplicateBranch()
 
     const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    std::list<Scope>::const_iterator scope;
+    std::deque<Scope>::const_iterator scope;
 
     for (scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
         if (scope->type != Scope::eIf)
@@ -1770,6 +1826,16 @@ void CheckOther::checkDuplicateBranch()
 
         // check all the code in the function for if (..) else
         if (Token::simpleMatch(scope->classEnd, "} else {")) {
+            // empty if branch
+            if (scope->classStart->next() == scope->classEnd)
+                continue;
+
+            // compare the if branch with the else branch token by token. In
+            // an else if chain the else branch holds the rest of the chain so
+            // stop at the first difference.
+            if (!isSameCode(scope->classStart->next(), scope->classEnd, scope->classEnd->tokAt(3), scope->classEnd->linkAt(2)))
+                continue;
+
             // Make sure there are no macros (different macros might be expanded
             // to the same code)
             bool macro = false;
@@ -1782,18 +1848,7 @@ void CheckOther::checkDuplicateBranch()
             if (macro)
                 continue;
 
-            // save if branch code
-            std::string branch1 = scope->classStart->next()->stringifyList(scope->classEnd);
-
-            if (branch1.empty())
-                continue;
-
-            // save else branch code
-            std::string branch2 = scope->classEnd->tokAt(3)->stringifyList(scope->classEnd->linkAt(2));
-
-            // check for duplicates
-            if (branch1 == branch2)
-                duplicateBranchError(scope->classDef, scope->classEnd->next());
+            duplicateBranchError(scope->classDef, scope->classEnd->next());
         }
     }
 }
@@ -1901,7 +1956,7 @@ namespace {
 
     void getConstFunctions(const SymbolDatabase *symbolDatabase, std::list<const Function*> &constFunctions)
     {
-        std::list<Scope>::const_iterator scope;
+        std::deque<Scope>::const_iterator scope;
         for (scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
             std::list<Function>::const_iterator func;
             // only add const functions that do not have a non-const overloaded version
@@ -1933,7 +1988,7 @@ void CheckOther::checkDuplicateExpression()
     // Parse all executing scopes..
     const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    std::list<Scope>::const_iterator scope;
+    std::deque<Scope>::const_iterator scope;
     std::list<const Function*> constFunctions;
     getConstFunctions(symbolDatabase, constFunctions);
 
@@ -2234,41 +2289,32 @@ static bool isNegative(const Token *tok, const Settings *settings)
     return tok->valueType() && tok->valueType()->sign == ValueType::SIGNED && tok->getValueLE(-1LL, settings);
 }
 
-void CheckOther::checkNegativeBitwiseShift()
+void CheckOther::checkNegativeBitwiseShift(const Token *tok)
 {
-    const bool portability = _settings->isEnabled(Settings::PORTABILITY);
-
-    for (const Token* tok = _tokenizer->tokens(); tok; tok = tok->next()) {
-        if (!tok->astOperand1() || !tok->astOperand2())
-            continue;
-
-        if (!Token::Match(tok, "<<|>>|<<=|>>="))
-            continue;
+    if (!tok->astOperand1() || !tok->astOperand2())
+        return;
 
-        // don't warn if lhs is a class. this is an overloaded operator then
-        if (_tokenizer->isCPP()) {
-            const ValueType * lhsType = tok->astOperand1()->valueType();
-            if (!lhsType || !lhsType->isIntegral())
-                continue;
-        }
+    if (!Token::Match(tok, "<<|>>|<<=|>>="))
+        return;
 
-        // bailout if operation is protected by ?:
-        bool ternary = false;
-        for (const Token *parent = tok; parent; parent = parent->astParent()) {
-            if (Token::Match(parent, "?|:")) {
-                ternary = true;
-                break;
-            }
-        }
-        if (ternary)
-            continue;
+    // don't warn if lhs is a class. this is an overloaded operator then
+    if (_tokenizer->isCPP()) {
+        const ValueType * lhsType = tok->astOperand1()->valueType();
+        if (!lhsType || !lhsType->isIntegral())
+            return;
+    }
 
-        // Get negative rhs value. preferably a value which doesn't have 'condition'.
-        if (portability && isNegative(tok->astOperand1(), _settings))
-            negativeBitwiseShiftError(tok, 1);
-        else if (isNegative(tok->astOperand2(), _settings))
-            negativeBitwiseShiftError(tok, 2);
+    // bailout if operation is protected by ?:
+    for (const Token *parent = tok; parent; parent = parent->astParent()) {
+        if (Token::Match(parent, "?|:"))
+            return;
     }
+
+    // Get negative rhs value. preferably a value which doesn't have 'condition'.
+    if (_settings->isEnabled(Settings::PORTABILITY) && isNegative(tok->astOperand1(), _settings))
+        negativeBitwiseShiftError(tok, 1);
+    else if (isNegative(tok->astOperand2(), _settings))
+        negativeBitwiseShiftError(tok, 2);
 }
 
 
@@ -2422,35 +2468,30 @@ void CheckOther::varFuncNullUBError(const Token *tok)
                 "}", CWE475, false);
 }
 
-void CheckOther::checkRedundantPointerOp()
+void CheckOther::checkRedundantPointerOp(const Token *tok)
 {
-    if (!_settings->isEnabled(Settings::STYLE))
+    if (tok->str() != "&")
         return;
 
-    const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
-    for (const Token *tok = _tokenizer->tokens(); tok; tok = tok->next()) {
-        if (tok->str() == "&") {
-            // bail out for logical AND operator
-            if (tok->astOperand2())
-                continue;
+    // bail out for logical AND operator
+    if (tok->astOperand2())
+        return;
 
-            // pointer dereference
-            const Token *astTok = tok->astOperand1();
-            if (!astTok || astTok->str() != "*")
-                continue;
+    // pointer dereference
+    const Token *astTok = tok->astOperand1();
+    if (!astTok || astTok->str() != "*")
+        return;
 
-            // variable
-            const Token *varTok = astTok->astOperand1();
-            if (!varTok || varTok->isExpandedMacro() || varTok->varId() == 0)
-                continue;
+    // variable
+    const Token *varTok = astTok->astOperand1();
+    if (!varTok || varTok->isExpandedMacro() || varTok->varId() == 0)
+        return;
 
-            const Variable *var = symbolDatabase->getVariableFromVarId(varTok->varId());
-            if (!var || !var->isPointer())
-                continue;
+    const Variable *var = _tokenizer->getSymbolDatabase()->getVariableFromVarId(varTok->varId());
+    if (!var || !var->isPointer())
+        return;
 
-            redundantPointerOpError(tok, var->name(), false);
-        }
-    }
+    redundantPointerOpError(tok, var->name(), false);
 }
 
 void CheckOther::redundantPointerOpError(const Token* tok, const std::string &varname, bool inconclusive)
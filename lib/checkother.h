@@ -72,11 +72,7 @@ public:
         checkOther.checkSignOfUnsignedVariable();  // don't ignore casts (#3574)
         checkOther.checkIncompleteArrayFill();
         checkOther.checkVarFuncNullUB();
-        checkOther.checkNanInArithmeticExpression();
         checkOther.checkCommaSeparatedReturn();
-        checkOther.checkRedundantPointerOp();
-        checkOther.checkZeroDivision();
-        checkOther.checkNegativeBitwiseShift();
         checkOther.checkInterlockedDecrement();
         checkOther.checkUnusedLabel();
         checkOther.checkEvaluationOrder();
@@ -104,6 +100,9 @@ public:
         checkOther.checkAccessOfMovedVariable();
     }
 
+    /** @brief Visitors for the checks that look at one token at a time */
+    void addVisitors(TokenTraversal *traversal, const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) const;
+
     /** @brief Clarify calculation for ".. a * b ? .." */
     void clarifyCalculation();
 
@@ -133,10 +132,10 @@ public:
     void checkIncompleteStatement();
 
     /** @brief %Check zero division*/
-    void checkZeroDivision();
+    void checkZeroDivision(const Token *tok);
 
     /** @brief Check for NaN (not-a-number) in an arithmetic expression */
-    void checkNanInArithmeticExpression();
+    void checkNanInArithmeticExpression(const Token *tok);
 
     /** @brief copying to memory or assigning to a variable twice */
     void checkRedundantAssignment();
@@ -176,7 +175,7 @@ public:
     void checkRedundantCopy();
 
     /** @brief %Check for bitwise shift with negative right operand */
-    void checkNegativeBitwiseShift();
+    void checkNegativeBitwiseShift(const Token *tok);
 
     /** @brief %Check for buffers that are filled incompletely with memset and similar functions */
     void checkIncompleteArrayFill();
@@ -194,7 +193,7 @@ public:
     void checkComparisonFunctionIsAlwaysTrueOrFalse();
 
     /** @brief %Check for redundant pointer operations */
-    void checkRedundantPointerOp();
+    void checkRedundantPointerOp(const Token *tok);
 
     /** @brief %Check for race condition with non-interlocked access after InterlockedDecrement() */
     void checkInterlockedDecrement();
@@ -272,6 +271,7 @@ private:
         c.negativeBitwiseShiftError(nullptr, 2);
         c.checkPipeParameterSizeError(nullptr,  "varname", "dimension");
         c.raceAfterInterlockedDecrementError(nullptr);
+        c.invalidFreeError(nullptr, false);
 
         //performance
         c.redundantCopyError(nullptr,  "varname");
@@ -290,6 +290,7 @@ private:
         c.variableScopeError(nullptr,  "varname");
         c.redundantAssignmentInSwitchError(nullptr,  0, "var");
         c.redundantCopyInSwitchError(nullptr,  0, "var");
+        c.redundantBitwiseOperationInSwitchError(nullptr, "varname");
         c.suspiciousCaseInSwitchError(nullptr,  "||");
         c.suspiciousEqualityComparisonError(nullptr);
         c.selfAssignmentError(nullptr,  "varname");
@@ -321,6 +322,15 @@ private:
         c.funcArgOrderDifferent("function", nullptr, nullptr, nullvec, nullvec);
     }
 
+    /** Divisions by possible zero values are warnings, incomplete fills of bool arrays are portability errors */
+    ErrorIds unlistedErrors() const {
+        ErrorIds errors;
+        errors.push_back(std::make_pair("zerodiv", Severity::warning));
+        errors.push_back(std::make_pair("zerodivcond", Severity::warning));
+        errors.push_back(std::make_pair("incompleteArrayFill", Severity::portability));
+        return errors;
+    }
+
     static std::string myName() {
         return "Other";
     }
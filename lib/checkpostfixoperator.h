@@ -58,6 +58,15 @@ public:
         checkPostfixOperator.postfixOperator();
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *tokenizer, const Settings *settings) const {
+        return tokenizer->isCPP() && settings->isEnabled(Settings::PERFORMANCE);
+    }
+
+    /** Only the function scopes are searched for postfix operators */
+    bool canSplitFunctionScopes() const {
+        return true;
+    }
+
     /** Check postfix operators */
     void postfixOperator();
 
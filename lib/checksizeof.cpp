@@ -27,6 +27,7 @@
 #include "tokenize.h"
 
 #include <cstddef>
+#include <vector>
 //---------------------------------------------------------------------------
 
 // Register this check class (by creating a static instance of it)
@@ -290,7 +291,9 @@ void CheckSizeof::sizeofCalculation()
 
     const bool printInconclusive = _settings->inconclusive;
 
-    for (const Token *tok = _tokenizer->tokens(); tok; tok = tok->next()) {
+    const std::vector<const Token *> &sizeofTokens = _tokenizer->list.tokensWithStr("sizeof");
+    for (std::size_t i = 0; i < sizeofTokens.size(); ++i) {
+        const Token *tok = sizeofTokens[i];
         if (Token::simpleMatch(tok, "sizeof (")) {
 
             // ignore if the `sizeof` result is cast to void inside a macro, i.e. the calculation is
@@ -325,7 +328,9 @@ void CheckSizeof::suspiciousSizeofCalculation()
         return;
 
     // TODO: Use AST here. This should be possible as soon as sizeof without brackets is correctly parsed
-    for (const Token *tok = _tokenizer->tokens(); tok; tok = tok->next()) {
+    const std::vector<const Token *> &sizeofTokens = _tokenizer->list.tokensWithStr("sizeof");
+    for (std::size_t i = 0; i < sizeofTokens.size(); ++i) {
+        const Token *tok = sizeofTokens[i];
         if (Token::simpleMatch(tok, "sizeof (")) {
             const Token* const end = tok->linkAt(1);
             const Variable* var = end->previous()->variable();
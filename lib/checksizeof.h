@@ -67,6 +67,10 @@ public:
     void runSimplifiedChecks(const Tokenizer*, const Settings*, ErrorLogger*) {
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *, const Settings *) const {
+        return false;
+    }
+
     /** @brief %Check for 'sizeof sizeof ..' */
     void sizeofsizeof();
 
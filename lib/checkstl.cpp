@@ -27,6 +27,7 @@
 #include "utils.h"
 
 #include <cstddef>
+#include <deque>
 #include <list>
 #include <set>
 #include <sstream>
@@ -373,7 +374,7 @@ void CheckStl::stlOutOfBounds()
     const SymbolDatabase* const symbolDatabase = _tokenizer->getSymbolDatabase();
 
     // Scan through all scopes..
-    for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
+    for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
         const Token* tok = i->classDef;
         // only interested in conditions
         if ((i->type != Scope::eFor && i->type != Scope::eWhile && i->type != Scope::eIf && i->type != Scope::eDo) || !tok)
@@ -441,7 +442,7 @@ void CheckStl::erase()
 {
     const SymbolDatabase* const symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
+    for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
         if (i->type == Scope::eFor && Token::simpleMatch(i->classDef, "for (")) {
             const Token *tok = i->classDef->linkAt(1);
             if (!Token::Match(tok->tokAt(-3), "; ++| %var% ++| ) {"))
@@ -705,7 +706,7 @@ void CheckStl::if_find()
 
     const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
+    for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
         if ((i->type != Scope::eIf && i->type != Scope::eWhile) || !i->classDef)
             continue;
 
@@ -857,7 +858,7 @@ void CheckStl::redundantCondition()
 
     const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
+    for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
         if (i->type != Scope::eIf)
             continue;
 
@@ -896,7 +897,7 @@ void CheckStl::missingComparison()
 
     const SymbolDatabase* const symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
+    for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.begin(); i != symbolDatabase->scopeList.end(); ++i) {
         if (i->type != Scope::eFor || !i->classDef)
             continue;
 
@@ -991,7 +992,7 @@ void CheckStl::string_c_str()
     // Find all functions that take std::string as argument
     std::multimap<std::string, unsigned int> c_strFuncParam;
     if (printPerformance) {
-        for (std::list<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
+        for (std::deque<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
             for (std::list<Function>::const_iterator func = scope->functionList.begin(); func != scope->functionList.end(); ++func) {
                 if (c_strFuncParam.erase(func->tokenDef->str()) != 0) { // Check if function with this name was already found
                     c_strFuncParam.insert(std::make_pair(func->tokenDef->str(), 0)); // Disable, because there are overloads. TODO: Handle overloads
@@ -1010,7 +1011,7 @@ void CheckStl::string_c_str()
     }
 
     // Try to detect common problems when using string::c_str()
-    for (std::list<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
+    for (std::deque<Scope>::const_iterator scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
         if (scope->type != Scope::eFunction || !scope->function)
             continue;
 
@@ -1412,8 +1413,8 @@ void CheckStl::checkDereferenceInvalidIterator()
 
     // Iterate over "if", "while", and "for" conditions where there may
     // be an iterator that is dereferenced before being checked for validity.
-    const std::list<Scope>& scopeList = _tokenizer->getSymbolDatabase()->scopeList;
-    for (std::list<Scope>::const_iterator i = scopeList.begin(); i != scopeList.end(); ++i) {
+    const std::deque<Scope>& scopeList = _tokenizer->getSymbolDatabase()->scopeList;
+    for (std::deque<Scope>::const_iterator i = scopeList.begin(); i != scopeList.end(); ++i) {
         if (!(i->type == Scope::eIf || i->type == Scope::eDo || i->type == Scope::eWhile || i->type == Scope::eFor))
             continue;
 
@@ -1527,9 +1528,9 @@ void CheckStl::readingEmptyStlContainer()
 
     std::map<unsigned int, const Library::Container*> emptyContainer;
 
-    const std::list<Scope>& scopeList = _tokenizer->getSymbolDatabase()->scopeList;
+    const std::deque<Scope>& scopeList = _tokenizer->getSymbolDatabase()->scopeList;
 
-    for (std::list<Scope>::const_iterator i = scopeList.begin(); i != scopeList.end(); ++i) {
+    for (std::deque<Scope>::const_iterator i = scopeList.begin(); i != scopeList.end(); ++i) {
         if (i->type != Scope::eFunction)
             continue;
 
@@ -79,6 +79,10 @@ public:
         checkStl.readingEmptyStlContainer();
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *tokenizer, const Settings *) const {
+        return tokenizer->isCPP();
+    }
+
 
     /**
      * Finds errors like this:
@@ -208,6 +212,7 @@ private:
         c.stlBoundariesError(nullptr);
         c.if_findError(nullptr, false);
         c.if_findError(nullptr, true);
+        c.string_c_strThrowError(nullptr);
         c.string_c_strError(nullptr);
         c.string_c_strReturn(nullptr);
         c.string_c_strParam(nullptr, 0);
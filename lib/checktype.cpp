@@ -29,6 +29,7 @@
 #include "tokenize.h"
 
 #include <cstddef>
+#include <vector>
 #include <list>
 #include <ostream>
 #include <stack>
@@ -234,8 +235,10 @@ void CheckType::checkLongCast()
         return;
 
     // Assignments..
-    for (const Token *tok = _tokenizer->tokens(); tok; tok = tok->next()) {
-        if (tok->str() != "=" || !Token::Match(tok->astOperand2(), "*|<<"))
+    const std::vector<const Token *> &assignments = _tokenizer->list.tokensWithStr("=");
+    for (std::size_t i = 0; i < assignments.size(); ++i) {
+        const Token *tok = assignments[i];
+        if (!Token::Match(tok->astOperand2(), "*|<<"))
             continue;
 
         const ValueType *lhstype = tok->astOperand1() ? tok->astOperand1()->valueType() : nullptr;
@@ -342,7 +345,7 @@ void CheckType::checkFloatToIntegerOverflow()
                 continue;
 
             const Token *op1 = tok->astOperand1();
-            for (std::list<ValueFlow::Value>::const_iterator it = op1->values().begin(); it != op1->values().end(); ++it) {
+            for (std::vector<ValueFlow::Value>::const_iterator it = op1->values().begin(); it != op1->values().end(); ++it) {
                 if (it->valueType != ValueFlow::Value::FLOAT)
                     continue;
                 if (!_settings->isEnabled(&(*it), false))
@@ -66,6 +66,10 @@ public:
         (void)errorLogger;
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *, const Settings *) const {
+        return false;
+    }
+
     /** @brief %Check for bitwise shift with too big right operand */
     void checkTooBigBitwiseShift();
 
@@ -103,6 +107,11 @@ private:
         c.floatToIntegerOverflowError(nullptr, f);
     }
 
+    /** Overflows of possible values are warnings */
+    ErrorIds unlistedErrors() const {
+        return ErrorIds(1, std::make_pair("integerOverflow", Severity::warning));
+    }
+
     static std::string myName() {
         return "Type";
     }
@@ -22,6 +22,7 @@
 
 #include "astutils.h"
 #include "checknullpointer.h"   // CheckNullPointer::isPointerDeref
+#include "controlflow.h"
 #include "errorlogger.h"
 #include "library.h"
 #include "mathlib.h"
@@ -33,10 +34,12 @@
 
 #include <cassert>
 #include <cstddef>
+#include <deque>
 #include <list>
 #include <map>
 #include <stack>
 #include <utility>
+#include <vector>
 //---------------------------------------------------------------------------
 
 // Register this check class (by creating a static instance of it)
@@ -55,7 +58,7 @@ static const struct CWE CWE825(825U);
 void CheckUninitVar::check()
 {
     const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
-    std::list<Scope>::const_iterator scope;
+    std::deque<Scope>::const_iterator scope;
 
     std::set<std::string> arrayTypeDefs;
     for (const Token *tok = _tokenizer->tokens(); tok; tok = tok->next()) {
@@ -63,15 +66,128 @@ void CheckUninitVar::check()
             arrayTypeDefs.insert(tok->variable()->typeStartToken()->str());
     }
 
+    // local variables that are assigned on every path before they are used
+    std::set<unsigned int> assignedBeforeUse;
+    for (std::size_t i = 0; i < symbolDatabase->functionScopes.size(); ++i)
+        getAssignedBeforeUse(symbolDatabase->functionScopes[i], &assignedBeforeUse);
+
     // check every executable scope
     for (scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
         if (scope->isExecutable()) {
-            checkScope(&*scope, arrayTypeDefs);
+            checkScope(&*scope, arrayTypeDefs, assignedBeforeUse);
         }
     }
 }
 
-void CheckUninitVar::checkScope(const Scope* scope, const std::set<std::string> &arrayTypeDefs)
+/** Is scope the function scope or a block in it, but not a lambda or a local class? */
+static bool isBlockInFunction(const Scope *scope, const Scope *functionScope)
+{
+    while (scope && scope != functionScope) {
+        if (!scope->isLocal())
+            return false;
+        scope = scope->nestedIn;
+    }
+    return scope != nullptr;
+}
+
+/**
+ * Update which variables are assigned when the tokens of a block are executed.
+ * An assignment "x = ..;" takes effect at the ';'. Any other usage of x is a
+ * read, also in lambdas and conditions, so the result is conservative.
+ * If killed is given, it tells which variables are unassigned by a declaration
+ * in the block and not assigned after it.
+ */
+static void definiteAssignmentTransfer(const ControlFlowGraph::BasicBlock &block,
+                                       const Scope *functionScope,
+                                       const std::map<unsigned int, std::size_t> &facts,
+                                       std::vector<bool> *assigned,
+                                       std::vector<bool> *killed,
+                                       std::set<unsigned int> *readUnassigned)
+{
+    std::vector<std::size_t> pending;
+    for (const Token *tok = block.start; tok && tok != block.end; tok = tok->next()) {
+        if (tok->str() == ";" && !pending.empty() && isBlockInFunction(tok->scope(), functionScope)) {
+            for (std::size_t i = 0; i < pending.size(); ++i) {
+                (*assigned)[pending[i]] = true;
+                if (killed)
+                    (*killed)[pending[i]] = false;
+            }
+            pending.clear();
+            continue;
+        }
+        if (!tok->varId())
+            continue;
+        const std::map<unsigned int, std::size_t>::const_iterator fact = facts.find(tok->varId());
+        if (fact == facts.end())
+            continue;
+        if (tok->variable() && tok == tok->variable()->nameToken()) {
+            (*assigned)[fact->second] = false;
+            if (killed)
+                (*killed)[fact->second] = true;
+        } else if (Token::Match(tok->previous(), "[;{}] %var% =") && isBlockInFunction(tok->scope(), functionScope))
+            pending.push_back(fact->second);
+        else if (readUnassigned && !(*assigned)[fact->second])
+            readUnassigned->insert(tok->varId());
+    }
+}
+
+/**
+ * Local variables in scope and its blocks that are declared without initializer.
+ * Variables that are assigned in the next statement are skipped, for them
+ * checkScopeForVariable is fast.
+ */
+static void getDefiniteAssignmentFacts(const Scope *scope, std::map<unsigned int, std::size_t> *facts)
+{
+    for (std::list<Variable>::const_iterator var = scope->varlist.begin(); var != scope->varlist.end(); ++var) {
+        if (var->isLocal() && !var->isStatic() && !var->isArray() && !var->isPointer() && !var->isReference() &&
+            var->nameToken() && var->declarationId() && var->nameToken()->strAt(1) == ";" &&
+            !Token::Match(var->nameToken()->tokAt(2), "%varid% =", var->declarationId())) {
+            const std::size_t index = facts->size();
+            (*facts)[var->declarationId()] = index;
+        }
+    }
+    for (std::vector<Scope *>::const_iterator nested = scope->nestedList.begin(); nested != scope->nestedList.end(); ++nested) {
+        if ((*nested)->isLocal())
+            getDefiniteAssignmentFacts(*nested, facts);
+    }
+}
+
+void CheckUninitVar::getAssignedBeforeUse(const Scope *functionScope, std::set<unsigned int> *assignedBeforeUse)
+{
+    // checkScopeForVariable is cheap in small functions
+    if (functionScope->classEnd->linenr() < functionScope->classStart->linenr() + 100U)
+        return;
+
+    std::map<unsigned int, std::size_t> facts;
+    getDefiniteAssignmentFacts(functionScope, &facts);
+    if (facts.empty())
+        return;
+
+    const ControlFlowGraph cfg(functionScope);
+    if (!cfg.isValid())
+        return;
+
+    const std::vector<ControlFlowGraph::BasicBlock> &blocks = cfg.blocks();
+    std::vector<std::vector<bool> > gen(blocks.size(), std::vector<bool>(facts.size(), false));
+    std::vector<std::vector<bool> > kill(blocks.size(), std::vector<bool>(facts.size(), false));
+    for (std::size_t b = 0; b < blocks.size(); ++b)
+        definiteAssignmentTransfer(blocks[b], functionScope, facts, &gen[b], &kill[b], nullptr);
+
+    const std::vector<std::vector<bool> > in = cfg.solve(ControlFlowGraph::FORWARD, ControlFlowGraph::INTERSECTION, gen, kill, std::vector<bool>(facts.size(), false));
+
+    std::set<unsigned int> readUnassigned;
+    for (std::size_t b = 0; b < blocks.size(); ++b) {
+        std::vector<bool> assigned(in[b]);
+        definiteAssignmentTransfer(blocks[b], functionScope, facts, &assigned, nullptr, &readUnassigned);
+    }
+
+    for (std::map<unsigned int, std::size_t>::const_iterator it = facts.begin(); it != facts.end(); ++it) {
+        if (readUnassigned.find(it->first) == readUnassigned.end())
+            assignedBeforeUse->insert(it->first);
+    }
+}
+
+void CheckUninitVar::checkScope(const Scope* scope, const std::set<std::string> &arrayTypeDefs, const std::set<unsigned int> &assignedBeforeUse)
 {
     for (std::list<Variable>::const_iterator i = scope->varlist.begin(); i != scope->varlist.end(); ++i) {
         if ((_tokenizer->isCPP() && i->type() && !i->isPointer() && i->type()->needInitialization != Type::True) ||
@@ -127,7 +243,7 @@ void CheckUninitVar::checkScope(const Scope* scope, const std::set<std::string>
             checkScopeForVariable(tok, *i, nullptr, nullptr, &alloc, emptyString);
             continue;
         }
-        if (stdtype || i->isPointer()) {
+        if ((stdtype || i->isPointer()) && assignedBeforeUse.find(i->declarationId()) == assignedBeforeUse.end()) {
             Alloc alloc = NO_ALLOC;
             checkScopeForVariable(tok, *i, nullptr, nullptr, &alloc, emptyString);
         }
@@ -171,7 +287,7 @@ void CheckUninitVar::checkStruct(const Token *tok, const Variable &structvar)
 
                 // is the variable declared in a inner union?
                 bool innerunion = false;
-                for (std::list<Scope>::const_iterator it2 = symbolDatabase->scopeList.begin(); it2 != symbolDatabase->scopeList.end(); ++it2) {
+                for (std::deque<Scope>::const_iterator it2 = symbolDatabase->scopeList.begin(); it2 != symbolDatabase->scopeList.end(); ++it2) {
                     const Scope &innerScope = *it2;
                     if (innerScope.type == Scope::eUnion && innerScope.nestedIn == scope2) {
                         if (var.typeStartToken()->linenr() >= innerScope.classStart->linenr() &&
@@ -1233,7 +1349,7 @@ void CheckUninitVar::valueFlowUninit()
         return;
 
     const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
-    std::list<Scope>::const_iterator scope;
+    std::deque<Scope>::const_iterator scope;
 
     // check every executable scope
     for (scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
@@ -1255,7 +1371,7 @@ void CheckUninitVar::valueFlowUninit()
 void CheckUninitVar::deadPointer()
 {
     const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
-    std::list<Scope>::const_iterator scope;
+    std::deque<Scope>::const_iterator scope;
 
     // check every executable scope
     for (scope = symbolDatabase->scopeList.begin(); scope != symbolDatabase->scopeList.end(); ++scope) {
@@ -62,7 +62,13 @@ public:
 
     /** Check for uninitialized variables */
     void check();
-    void checkScope(const Scope* scope, const std::set<std::string> &arrayTypeDefs);
+    void checkScope(const Scope* scope, const std::set<std::string> &arrayTypeDefs, const std::set<unsigned int> &assignedBeforeUse);
+
+    /**
+     * Find local variables without initializer that are assigned on every
+     * path before they are used. Their scope does not need to be checked.
+     */
+    static void getAssignedBeforeUse(const Scope *functionScope, std::set<unsigned int> *assignedBeforeUse);
     void checkStruct(const Token *tok, const Variable &structvar);
     enum Alloc { NO_ALLOC, NO_CTOR_CALL, CTOR_CALL, ARRAY };
     bool checkScopeForVariable(const Token *tok, const Variable& var, bool* const possibleInit, bool* const noreturn, Alloc* const alloc, const std::string &membervar);
@@ -89,6 +89,10 @@ private:
      */
     void runSimplifiedChecks(const Tokenizer *, const Settings *, ErrorLogger *) {}
 
+    bool needsSimplifiedTokens(const Tokenizer *, const Settings *) const {
+        return false;
+    }
+
     static std::string myName() {
         return "Unused functions";
     }
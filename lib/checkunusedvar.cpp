@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <cctype>
 #include <cstddef>
+#include <deque>
 #include <list>
 #include <set>
 #include <utility>
@@ -799,7 +800,7 @@ void CheckUnusedVar::checkFunctionVariableUsage_iterateScopes(const Scope* const
         tok = scope->classDef->next();
     for (; tok && tok != scope->classEnd; tok = tok->next()) {
         if (tok->str() == "for" || tok->str() == "while" || tok->str() == "do") {
-            for (std::list<Scope*>::const_iterator i = scope->nestedList.begin(); i != scope->nestedList.end(); ++i) {
+            for (std::vector<Scope *>::const_iterator i = scope->nestedList.begin(); i != scope->nestedList.end(); ++i) {
                 if ((*i)->classDef == tok) { // Find associated scope
                     checkFunctionVariableUsage_iterateScopes(*i, variables, true); // Scan child scope
                     tok = (*i)->classStart->link();
@@ -810,7 +811,7 @@ void CheckUnusedVar::checkFunctionVariableUsage_iterateScopes(const Scope* const
                 break;
         }
         if (tok->str() == "{" && tok != scope->classStart && !tok->previous()->varId()) {
-            for (std::list<Scope*>::const_iterator i = scope->nestedList.begin(); i != scope->nestedList.end(); ++i) {
+            for (std::vector<Scope *>::const_iterator i = scope->nestedList.begin(); i != scope->nestedList.end(); ++i) {
                 if ((*i)->classStart == tok) { // Find associated scope
                     checkFunctionVariableUsage_iterateScopes(*i, variables, false); // Scan child scope
                     tok = tok->link();
@@ -1309,7 +1310,7 @@ void CheckUnusedVar::checkStructMemberUsage()
 
     const SymbolDatabase *symbolDatabase = _tokenizer->getSymbolDatabase();
 
-    for (std::list<Scope>::const_iterator scope = symbolDatabase->scopeList.cbegin(); scope != symbolDatabase->scopeList.cend(); ++scope) {
+    for (std::deque<Scope>::const_iterator scope = symbolDatabase->scopeList.cbegin(); scope != symbolDatabase->scopeList.cend(); ++scope) {
         if (scope->type != Scope::eStruct && scope->type != Scope::eUnion)
             continue;
 
@@ -1326,7 +1327,7 @@ void CheckUnusedVar::checkStructMemberUsage()
 
         // bail out if struct is inherited
         bool bailout = false;
-        for (std::list<Scope>::const_iterator i = symbolDatabase->scopeList.cbegin(); i != symbolDatabase->scopeList.cend(); ++i) {
+        for (std::deque<Scope>::const_iterator i = symbolDatabase->scopeList.cbegin(); i != symbolDatabase->scopeList.cend(); ++i) {
             if (i->definedType) {
                 for (size_t j = 0; j < i->definedType->derivedFrom.size(); j++) {
                     if (i->definedType->derivedFrom[j].type == scope->definedType) {
@@ -68,6 +68,10 @@ public:
         (void)errorLogger;
     }
 
+    bool needsSimplifiedTokens(const Tokenizer *, const Settings *) const {
+        return false;
+    }
+
     /** @brief %Check for unused function variables */
     void checkFunctionVariableUsage_iterateScopes(const Scope* const scope, Variables& variables, bool insideLoop);
     void checkFunctionVariableUsage();
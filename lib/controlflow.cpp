@@ -0,0 +1,428 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2016 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+//---------------------------------------------------------------------------
+#include "controlflow.h"
+
+#include "symboldatabase.h"
+#include "token.h"
+
+#include <climits>
+#include <deque>
+
+ControlFlowGraph::ControlFlowGraph(const Scope *scope)
+    : _valid(true)
+{
+    newBlock(); // ENTRY
+    newBlock(); // EXIT
+    if (!scope || !scope->classStart || !scope->classEnd) {
+        _valid = false;
+        return;
+    }
+
+    const std::size_t body = newBlock();
+    addEdge(ENTRY, body);
+    const std::size_t last = buildBody(scope->classStart->next(), scope->classEnd, body);
+    addEdge(last, EXIT);
+
+    for (std::size_t i = 0; i < _gotos.size(); ++i) {
+        const std::map<std::string, std::size_t>::const_iterator label = _labels.find(_gotos[i].second);
+        if (label == _labels.end()) {
+            _valid = false;
+            return;
+        }
+        addEdge(_gotos[i].first, label->second);
+    }
+}
+
+std::size_t ControlFlowGraph::newBlock()
+{
+    _blocks.push_back(BasicBlock());
+    return _blocks.size() - 1U;
+}
+
+void ControlFlowGraph::addEdge(std::size_t from, std::size_t to)
+{
+    _blocks[from].successors.push_back(to);
+    _blocks[to].predecessors.push_back(from);
+}
+
+void ControlFlowGraph::append(std::size_t block, const Token *start, const Token *end)
+{
+    if (!_blocks[block].start)
+        _blocks[block].start = start;
+    _blocks[block].end = end;
+}
+
+std::size_t ControlFlowGraph::buildBody(const Token *start, const Token *end, std::size_t cur)
+{
+    for (const Token *tok = start; _valid && tok != end;) {
+        tok = buildStatement(tok, end, &cur);
+        if (!tok)
+            _valid = false;
+    }
+    return cur;
+}
+
+/** Token after the ';' that ends the statement, skipping brackets. nullptr if there is no ';' before end */
+static const Token *statementEnd(const Token *tok, const Token *end)
+{
+    for (; tok && tok != end; tok = tok->next()) {
+        if (Token::Match(tok, "(|[|{")) {
+            if (!tok->link())
+                return nullptr;
+            tok = tok->link();
+        } else if (tok->str() == ";") {
+            return tok->next();
+        }
+    }
+    return nullptr;
+}
+
+const Token *ControlFlowGraph::buildStatement(const Token *tok, const Token *end, std::size_t *cur)
+{
+    if (tok->str() == "{") {
+        if (!tok->link())
+            return nullptr;
+        *cur = buildBody(tok->next(), tok->link(), *cur);
+        return tok->link()->next();
+    }
+
+    if (Token::simpleMatch(tok, "if (")) {
+        const Token *thenStart = tok->linkAt(1)->next();
+        if (!Token::simpleMatch(thenStart, "{"))
+            return nullptr;
+        append(*cur, tok, thenStart);
+        const std::size_t cond = *cur;
+        const std::size_t thenBlock = newBlock();
+        addEdge(cond, thenBlock);
+        const std::size_t thenEnd = buildBody(thenStart->next(), thenStart->link(), thenBlock);
+        const Token *next = thenStart->link()->next();
+        const std::size_t join = newBlock();
+        addEdge(thenEnd, join);
+        if (Token::simpleMatch(next, "else {")) {
+            const std::size_t elseBlock = newBlock();
+            addEdge(cond, elseBlock);
+            const std::size_t elseEnd = buildBody(next->tokAt(2), next->linkAt(1), elseBlock);
+            addEdge(elseEnd, join);
+            next = next->linkAt(1)->next();
+        } else {
+            addEdge(cond, join);
+        }
+        *cur = join;
+        return next;
+    }
+
+    if (Token::Match(tok, "while|for (")) {
+        const Token *bodyStart = tok->linkAt(1)->next();
+        if (!Token::simpleMatch(bodyStart, "{"))
+            return nullptr;
+
+        // for (init; cond; incr)
+        const Token *semicolon1 = nullptr, *semicolon2 = nullptr;
+        if (tok->str() == "for") {
+            for (const Token *tok2 = tok->tokAt(2); tok2 && tok2 != tok->linkAt(1); tok2 = tok2->next()) {
+                if (Token::Match(tok2, "(|[|{"))
+                    tok2 = tok2->link();
+                else if (tok2->str() == ";" && !semicolon1)
+                    semicolon1 = tok2;
+                else if (tok2->str() == ";")
+                    semicolon2 = tok2;
+            }
+        }
+
+        const std::size_t head = newBlock();
+        std::size_t latch = head;
+        bool infinite = false;
+        if (semicolon2) {
+            append(*cur, tok, semicolon1->next());
+            append(head, semicolon1->next(), semicolon2->next());
+            latch = newBlock();
+            append(latch, semicolon2->next(), bodyStart);
+            addEdge(latch, head);
+            infinite = (semicolon1->next() == semicolon2);
+        } else {
+            append(head, tok, bodyStart);
+        }
+        addEdge(*cur, head);
+        const std::size_t body = newBlock();
+        const std::size_t after = newBlock();
+        addEdge(head, body);
+        if (!infinite)
+            addEdge(head, after);
+
+        _breakTargets.push_back(after);
+        _continueTargets.push_back(latch);
+        const std::size_t bodyEnd = buildBody(bodyStart->next(), bodyStart->link(), body);
+        _breakTargets.pop_back();
+        _continueTargets.pop_back();
+        addEdge(bodyEnd, latch);
+
+        *cur = after;
+        return bodyStart->link()->next();
+    }
+
+    if (Token::simpleMatch(tok, "do {")) {
+        const Token *bodyEndToken = tok->linkAt(1);
+        if (!Token::simpleMatch(bodyEndToken, "} while ("))
+            return nullptr;
+        const Token *next = bodyEndToken->linkAt(2)->next();
+        if (!Token::simpleMatch(next, ";"))
+            return nullptr;
+
+        const std::size_t body = newBlock();
+        const std::size_t cond = newBlock();
+        const std::size_t after = newBlock();
+        addEdge(*cur, body);
+        append(body, tok, tok->tokAt(2));
+
+        _breakTargets.push_back(after);
+        _continueTargets.push_back(cond);
+        const std::size_t bodyEnd = buildBody(tok->tokAt(2), bodyEndToken, body);
+        _breakTargets.pop_back();
+        _continueTargets.pop_back();
+
+        addEdge(bodyEnd, cond);
+        append(cond, bodyEndToken->next(), next->next());
+        addEdge(cond, body);
+        addEdge(cond, after);
+        *cur = after;
+        return next->next();
+    }
+
+    if (Token::simpleMatch(tok, "switch (")) {
+        const Token *bodyStart = tok->linkAt(1)->next();
+        if (!Token::simpleMatch(bodyStart, "{"))
+            return nullptr;
+        append(*cur, tok, bodyStart->next());
+        const std::size_t head = *cur;
+        const std::size_t after = newBlock();
+
+        _breakTargets.push_back(after);
+        _switches.push_back(std::make_pair(head, false));
+        // code before the first case label is not reachable
+        const std::size_t bodyEnd = buildBody(bodyStart->next(), bodyStart->link(), newBlock());
+        const bool hasDefault = _switches.back().second;
+        _switches.pop_back();
+        _breakTargets.pop_back();
+
+        addEdge(bodyEnd, after);
+        if (!hasDefault)
+            addEdge(head, after);
+        *cur = after;
+        return bodyStart->link()->next();
+    }
+
+    if (Token::Match(tok, "case|default")) {
+        if (_switches.empty())
+            return nullptr;
+        const Token *colon = tok->next();
+        while (colon && colon != end && colon->str() != ":") {
+            if (Token::Match(colon, "(|["))
+                colon = colon->link();
+            colon = colon ? colon->next() : nullptr;
+        }
+        if (!colon || colon == end)
+            return nullptr;
+        if (tok->str() == "default")
+            _switches.back().second = true;
+        const std::size_t label = newBlock();
+        addEdge(*cur, label);
+        addEdge(_switches.back().first, label);
+        append(label, tok, colon->next());
+        *cur = label;
+        return colon->next();
+    }
+
+    if (Token::Match(tok, "%name% :") && !Token::Match(tok, "public|protected|private")) {
+        const std::size_t label = newBlock();
+        addEdge(*cur, label);
+        _labels[tok->str()] = label;
+        append(label, tok, tok->tokAt(2));
+        *cur = label;
+        return tok->tokAt(2);
+    }
+
+    if (Token::simpleMatch(tok, "try {")) {
+        const std::size_t before = *cur;
+        const std::size_t tryBlock = newBlock();
+        addEdge(before, tryBlock);
+        append(tryBlock, tok, tok->tokAt(2));
+        const std::size_t tryEnd = buildBody(tok->tokAt(2), tok->linkAt(1), tryBlock);
+        const std::size_t blocksInTry = _blocks.size();
+        const std::size_t after = newBlock();
+        addEdge(tryEnd, after);
+
+        // any statement in the try block might throw
+        const Token *next = tok->linkAt(1)->next();
+        while (Token::simpleMatch(next, "catch (") && Token::simpleMatch(next->linkAt(1), ") {")) {
+            const std::size_t handler = newBlock();
+            addEdge(before, handler);
+            for (std::size_t b = tryBlock; b < blocksInTry; ++b)
+                addEdge(b, handler);
+            const Token *handlerStart = next->linkAt(1)->next();
+            append(handler, next, handlerStart->next());
+            const std::size_t handlerEnd = buildBody(handlerStart->next(), handlerStart->link(), handler);
+            addEdge(handlerEnd, after);
+            next = handlerStart->link()->next();
+        }
+        *cur = after;
+        return next;
+    }
+
+    if (Token::Match(tok, "else|catch"))
+        return nullptr;
+
+    const Token *next = statementEnd(tok, end);
+    if (!next)
+        return nullptr;
+    append(*cur, tok, next);
+
+    if (Token::Match(tok, "return|throw")) {
+        addEdge(*cur, EXIT);
+        *cur = newBlock();
+    } else if (Token::Match(tok, "break|continue ;")) {
+        std::vector<std::size_t> &targets = (tok->str() == "break") ? _breakTargets : _continueTargets;
+        if (targets.empty())
+            return nullptr;
+        addEdge(*cur, targets.back());
+        *cur = newBlock();
+    } else if (Token::Match(tok, "goto %name% ;")) {
+        _gotos.push_back(std::make_pair(*cur, tok->strAt(1)));
+        *cur = newBlock();
+    }
+    return next;
+}
+
+namespace {
+    /** Facts of all blocks, packed in words */
+    class BitMatrix {
+    public:
+        typedef unsigned long Word;
+        enum { BITS = sizeof(Word) * CHAR_BIT };
+
+        BitMatrix(std::size_t rows, std::size_t columns, bool value)
+            : _words((columns + BITS - 1) / BITS), _data(rows * _words, value ? ~Word(0) : Word(0)) {
+        }
+
+        std::size_t words() const {
+            return _words;
+        }
+        Word *row(std::size_t r) {
+            return &_data[r * _words];
+        }
+        const Word *row(std::size_t r) const {
+            return &_data[r * _words];
+        }
+
+        void set(std::size_t r, const std::vector<bool> &bits) {
+            Word *w = row(r);
+            for (std::size_t i = 0; i < _words; ++i)
+                w[i] = 0;
+            for (std::size_t i = 0; i < bits.size(); ++i) {
+                if (bits[i])
+                    w[i / BITS] |= Word(1) << (i % BITS);
+            }
+        }
+        std::vector<bool> get(std::size_t r, std::size_t columns) const {
+            std::vector<bool> bits(columns);
+            const Word *w = row(r);
+            for (std::size_t i = 0; i < columns; ++i)
+                bits[i] = (w[i / BITS] >> (i % BITS)) & 1U;
+            return bits;
+        }
+
+    private:
+        std::size_t _words;
+        std::vector<Word> _data;
+    };
+}
+
+std::vector<std::vector<bool> > ControlFlowGraph::solve(Direction direction, Meet meet,
+        const std::vector<std::vector<bool> > &gen,
+        const std::vector<std::vector<bool> > &kill,
+        const std::vector<bool> &boundary) const
+{
+    const std::size_t numberOfFacts = boundary.size();
+    const std::size_t first = (direction == FORWARD) ? ENTRY : EXIT;
+
+    BitMatrix genBits(_blocks.size(), numberOfFacts, false);
+    BitMatrix killBits(_blocks.size(), numberOfFacts, false);
+    for (std::size_t b = 0; b < _blocks.size(); ++b) {
+        genBits.set(b, gen[b]);
+        killBits.set(b, kill[b]);
+    }
+
+    // with intersection everything is true until proven otherwise
+    BitMatrix in(_blocks.size(), numberOfFacts, meet == INTERSECTION);
+    BitMatrix out(_blocks.size(), numberOfFacts, meet == INTERSECTION);
+    in.set(first, boundary);
+    const std::size_t words = in.words();
+
+    std::deque<std::size_t> worklist;
+    std::vector<bool> queued(_blocks.size(), true);
+    for (std::size_t b = 0; b < _blocks.size(); ++b)
+        worklist.push_back(b);
+
+    while (!worklist.empty()) {
+        const std::size_t b = worklist.front();
+        worklist.pop_front();
+        queued[b] = false;
+
+        BitMatrix::Word *facts = in.row(b);
+        const std::vector<std::size_t> &sources = (direction == FORWARD) ? _blocks[b].predecessors : _blocks[b].successors;
+        if (b != first && !sources.empty()) {
+            const BitMatrix::Word *source = out.row(sources[0]);
+            for (std::size_t w = 0; w < words; ++w)
+                facts[w] = source[w];
+            for (std::size_t s = 1; s < sources.size(); ++s) {
+                source = out.row(sources[s]);
+                for (std::size_t w = 0; w < words; ++w)
+                    facts[w] = (meet == UNION) ? (facts[w] | source[w]) : (facts[w] & source[w]);
+            }
+        }
+
+        const BitMatrix::Word *g = genBits.row(b);
+        const BitMatrix::Word *k = killBits.row(b);
+        BitMatrix::Word *result = out.row(b);
+        bool changed = false;
+        for (std::size_t w = 0; w < words; ++w) {
+            const BitMatrix::Word value = g[w] | (facts[w] & ~k[w]);
+            if (value != result[w]) {
+                result[w] = value;
+                changed = true;
+            }
+        }
+        if (!changed)
+            continue;
+
+        const std::vector<std::size_t> &targets = (direction == FORWARD) ? _blocks[b].successors : _blocks[b].predecessors;
+        for (std::size_t t = 0; t < targets.size(); ++t) {
+            if (!queued[targets[t]]) {
+                queued[targets[t]] = true;
+                worklist.push_back(targets[t]);
+            }
+        }
+    }
+
+    std::vector<std::vector<bool> > ret(_blocks.size());
+    for (std::size_t b = 0; b < _blocks.size(); ++b)
+        ret[b] = in.get(b, numberOfFacts);
+    return ret;
+}
@@ -0,0 +1,129 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2016 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+//---------------------------------------------------------------------------
+#ifndef controlflowH
+#define controlflowH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Scope;
+class Token;
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Control flow graph of a function body
+ *
+ * The body is split into basic blocks. A basic block is a token range
+ * [start,end) that is executed from start to end without jumps into or out
+ * of it. The condition of an if/while/for/switch ends the block it is in.
+ * Expressions are not split, so both operands of && || ?: are in the same
+ * block, and so are lambdas and local classes.
+ *
+ * Block ENTRY and block EXIT are empty. Code after return/break/etc is put
+ * in blocks that have no predecessors.
+ */
+class CPPCHECKLIB ControlFlowGraph {
+public:
+    struct BasicBlock {
+        BasicBlock() : start(nullptr), end(nullptr) {
+        }
+
+        /** first token, nullptr if the block is empty */
+        const Token *start;
+
+        /** token after the last token */
+        const Token *end;
+
+        std::vector<std::size_t> successors;
+        std::vector<std::size_t> predecessors;
+    };
+
+    enum { ENTRY = 0, EXIT = 1 };
+
+    /** Build the graph for the body of the given function scope */
+    explicit ControlFlowGraph(const Scope *scope);
+
+    /** Was the whole body understood? If not, the graph must not be used. */
+    bool isValid() const {
+        return _valid;
+    }
+
+    const std::vector<BasicBlock> &blocks() const {
+        return _blocks;
+    }
+
+    enum Direction { FORWARD, BACKWARD };
+
+    /** How the facts from several predecessors are combined */
+    enum Meet { UNION, INTERSECTION };
+
+    /**
+     * Solve a bit vector dataflow problem with a worklist. For each block
+     * b the facts after it are gen[b] | (facts before it & ~kill[b]).
+     * @param direction forward or backward problem
+     * @param meet combine facts with union (may) or intersection (must)
+     * @param gen facts generated by each block
+     * @param kill facts killed by each block
+     * @param boundary facts before ENTRY (forward) or after EXIT (backward)
+     * @return the facts before each block, in the direction of the problem
+     */
+    std::vector<std::vector<bool> > solve(Direction direction, Meet meet,
+                                          const std::vector<std::vector<bool> > &gen,
+                                          const std::vector<std::vector<bool> > &kill,
+                                          const std::vector<bool> &boundary) const;
+
+private:
+    std::size_t newBlock();
+    void addEdge(std::size_t from, std::size_t to);
+    void append(std::size_t block, const Token *start, const Token *end);
+
+    /** Add the statements in [start,end) to the graph, starting in block cur */
+    std::size_t buildBody(const Token *start, const Token *end, std::size_t cur);
+
+    /** Add one statement, returns the token after it or nullptr if the statement is not understood */
+    const Token *buildStatement(const Token *tok, const Token *end, std::size_t *cur);
+
+    std::vector<BasicBlock> _blocks;
+    bool _valid;
+
+    /** targets of break and continue in the enclosing loops/switches */
+    std::vector<std::size_t> _breakTargets;
+    std::vector<std::size_t> _continueTargets;
+
+    /** enclosing switch statements: block with the condition, has default */
+    std::vector<std::pair<std::size_t, bool> > _switches;
+
+    /** labels and the blocks that jump to them */
+    std::map<std::string, std::size_t> _labels;
+    std::vector<std::pair<std::size_t, std::string> > _gotos;
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // controlflowH
@@ -25,16 +25,20 @@
 #include "platform.h"
 #include "preprocessor.h" // Preprocessor
 #include "suppressions.h"
+#include "symboldatabase.h"
 #include "timer.h"
 #include "token.h"
 #include "tokenize.h" // Tokenizer
 #include "tokenlist.h"
+#include "tokenvisitor.h"
+#include "valueflow.h"
 #include "version.h"
 
 #include <simplecpp.h>
 #include <tinyxml2.h>
 #include <algorithm>
 #include <cstring>
+#include <map>
 #include <new>
 #include <set>
 #include <stdexcept>
@@ -54,7 +58,7 @@ static TimerResults S_timerResults;
 static const CWE CWE398(398U);  // Indicator of Poor Code Quality
 
 CppCheck::CppCheck(ErrorLogger &errorLogger, bool useGlobalSuppressions)
-    : _errorLogger(errorLogger), exitcode(0), _useGlobalSuppressions(useGlobalSuppressions), tooManyConfigs(false), _simplify(true)
+    : _errorLogger(errorLogger), exitcode(0), _useGlobalSuppressions(useGlobalSuppressions), tooManyConfigs(false), _simplify(true), _partsExecutor(nullptr)
 {
 }
 
@@ -93,6 +97,8 @@ unsigned int CppCheck::check(const ImportProject::FileSettings &fs)
 {
     CppCheck temp(_errorLogger, _useGlobalSuppressions);
     temp._settings = _settings;
+    temp._listedErrors = _listedErrors;
+    temp._listedFunctionwarn = _listedFunctionwarn;
     temp._settings.userDefines = fs.defines;
     temp._settings.includePaths = fs.includePaths;
     // TODO: temp._settings.userUndefs = fs.undefs;
@@ -114,6 +120,8 @@ unsigned int CppCheck::processFile(const std::string& filename, const std::strin
     if (_settings.terminated())
         return exitcode;
 
+    findEnabledChecks();
+
     if (_settings.quiet == false) {
         std::string fixedpath = Path::simplifyPath(filename);
         fixedpath = Path::toNativeSeparators(fixedpath);
@@ -332,6 +340,7 @@ unsigned int CppCheck::processFile(const std::string& filename, const std::strin
             Tokenizer _tokenizer(&_settings, this);
             if (_settings.showtime != SHOWTIME_NONE)
                 _tokenizer.setTimerResults(&S_timerResults);
+            _tokenizer.setAnalyzerInformation(&analyzerInformation);
 
             try {
                 bool result;
@@ -353,39 +362,56 @@ unsigned int CppCheck::processFile(const std::string& filename, const std::strin
 
                 // Simplify tokens into normal form, skip rest of iteration if failed
                 Timer timer2("Tokenizer::simplifyTokens1", _settings.showtime, &S_timerResults);
-                result = _tokenizer.simplifyTokens1(cfg);
-                timer2.Stop();
+                result = _tokenizer.simplifyTokens1Syntax(cfg);
                 if (!result)
                     continue;
 
+                // Skip if we already met the same simplified token list. The symbol
+                // database and ValueFlow would be the same as for that configuration,
+                // so they are only created if they are dumped.
+                const bool dumpCfg = _settings.dump && fdump.is_open();
+                bool purged = false;
+                if (_settings.force || _settings.maxConfigs > 1) {
+                    const unsigned long long checksum = _tokenizer.list.calculateChecksum();
+                    purged = !checksums.insert(checksum).second;
+                }
+                if (purged && !dumpCfg) {
+                    if (_settings.isEnabled(Settings::INFORMATION) && (_settings.debug || _settings.verbose))
+                        purgedConfigurationMessage(filename, cfg);
+                    continue;
+                }
+
+                _tokenizer.simplifyTokens1Symbols();
+                timer2.Stop();
+
                 // dump xml if --dump
-                if (_settings.dump && fdump.is_open()) {
+                if (dumpCfg) {
                     fdump << "<dump cfg=\"" << cfg << "\">" << std::endl;
                     preprocessor.dump(fdump);
                     _tokenizer.dump(fdump);
                     fdump << "</dump>" << std::endl;
                 }
 
-                // Skip if we already met the same simplified token list
-                if (_settings.force || _settings.maxConfigs > 1) {
-                    const unsigned long long checksum = _tokenizer.list.calculateChecksum();
-                    if (checksums.find(checksum) != checksums.end()) {
-                        if (_settings.isEnabled(Settings::INFORMATION) && (_settings.debug || _settings.verbose))
-                            purgedConfigurationMessage(filename, cfg);
-                        continue;
-                    }
-                    checksums.insert(checksum);
+                if (purged) {
+                    if (_settings.isEnabled(Settings::INFORMATION) && (_settings.debug || _settings.verbose))
+                        purgedConfigurationMessage(filename, cfg);
+                    continue;
                 }
 
                 // Check normal tokens
                 checkNormalTokens(_tokenizer);
 
                 // Analyze info..
-                if (!_settings.buildDir.empty())
+                if (!_settings.buildDir.empty()) {
                     checkUnusedFunctions.parseTokens(_tokenizer, filename.c_str(), &_settings, false);
 
+                    std::map<std::string, long long> returnValues;
+                    ValueFlow::getReturnValues(_tokenizer.getSymbolDatabase(), &returnValues);
+                    analyzerInformation.setReturnValues(returnValues);
+                }
+
                 // simplify more if required, skip rest of iteration if failed
-                if (_simplify) {
+                if (_simplify && needsSimplifiedTokens(_tokenizer)) {
                     // if further simplification fails then skip rest of iteration
                     Timer timer3("Tokenizer::simplifyTokenList2", _settings.showtime, &S_timerResults);
                     result = _tokenizer.simplifyTokenList2();
@@ -489,18 +515,90 @@ void CppCheck::checkRawTokens(const Tokenizer &tokenizer)
 // CppCheck - A function that checks a normal token list
 //---------------------------------------------------------------------------
 
+bool CppCheck::runChecksInParts(const Tokenizer &tokenizer, bool simplified)
+{
+    // The timer results of the parts would be lost
+    if (!_partsExecutor || _settings.functionJobs <= 1 || _settings.showtime != SHOWTIME_NONE)
+        return false;
+
+    const std::vector<const Scope *> &functionScopes = tokenizer.getSymbolDatabase()->functionScopes;
+    const std::size_t jobs = std::min<std::size_t>(_settings.functionJobs, functionScopes.size());
+    if (jobs <= 1)
+        return false;
+
+    // Split the function scopes into parts with about the same amount of tokens
+    std::vector<std::size_t> sizes;
+    std::size_t totalSize = 0;
+    for (std::size_t i = 0; i < functionScopes.size(); ++i) {
+        std::size_t size = 1;
+        for (const Token *tok = functionScopes[i]->classStart; tok && tok != functionScopes[i]->classEnd; tok = tok->next())
+            ++size;
+        sizes.push_back(size);
+        totalSize += size;
+    }
+    _partEnd.clear();
+    std::size_t size = 0;
+    for (std::size_t i = 0; i < functionScopes.size(); ++i) {
+        size += sizes[i];
+        if (_partEnd.size() + 1 < jobs && size * jobs >= totalSize * (_partEnd.size() + 1))
+            _partEnd.push_back(i + 1);
+    }
+    _partEnd.push_back(functionScopes.size());
+
+    std::string failure;
+    const bool run = _partsExecutor->run(*this, tokenizer, simplified, _partEnd.size(), *this, &failure);
+    if (!failure.empty())
+        internalError(tokenizer.list.getSourceFilePath(), failure);
+    return run;
+}
+
+void CppCheck::runChecksOfPart(const Tokenizer &tokenizer, bool simplified, std::size_t part, ErrorLogger &errorLogger)
+{
+    // The function scopes of the symbol database are restored when the part is done
+    std::vector<const Scope *> &functionScopes = const_cast<SymbolDatabase *>(tokenizer.getSymbolDatabase())->functionScopes;
+    const std::vector<const Scope *> allScopes(functionScopes);
+    const std::vector<const Scope *> partScopes(allScopes.begin() + (part > 0 ? _partEnd[part - 1] : 0), allScopes.begin() + _partEnd[part]);
+
+    for (std::list<Check *>::const_iterator it = _checks.begin(); it != _checks.end(); ++it) {
+        if (_settings.terminated() || tokenizer.isMaxTime())
+            break;
+        // The first part runs the checks that can not be split
+        if ((*it)->canSplitFunctionScopes())
+            functionScopes = partScopes;
+        else if (part == 0)
+            functionScopes = allScopes;
+        else
+            continue;
+        if (simplified)
+            (*it)->runSimplifiedChecks(&tokenizer, &_settings, &errorLogger);
+        else
+            (*it)->runChecks(&tokenizer, &_settings, &errorLogger);
+    }
+    functionScopes = allScopes;
+}
+
 void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
 {
     // call all "runChecks" in all registered Check classes
-    for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
-        if (_settings.terminated())
-            return;
+    if (!runChecksInParts(tokenizer, false)) {
+        for (std::list<Check *>::const_iterator it = _checks.begin(); it != _checks.end(); ++it) {
+            if (_settings.terminated())
+                return;
 
-        if (tokenizer.isMaxTime())
-            return;
+            if (tokenizer.isMaxTime())
+                return;
+
+            Timer timerRunChecks((*it)->name() + "::runChecks", _settings.showtime, &S_timerResults);
+            (*it)->runChecks(&tokenizer, &_settings, this);
+        }
+    }
 
-        Timer timerRunChecks((*it)->name() + "::runChecks", _settings.showtime, &S_timerResults);
-        (*it)->runChecks(&tokenizer, &_settings, this);
+    // Run the visitors of all checks in one traversal of the tokens
+    if (!_settings.terminated() && !tokenizer.isMaxTime()) {
+        TokenTraversal traversal;
+        for (std::list<Check *>::const_iterator it = _checks.begin(); it != _checks.end(); ++it)
+            (*it)->addVisitors(&traversal, &tokenizer, &_settings, this);
+        traversal.run(tokenizer.tokens(), _settings.showtime, &S_timerResults);
     }
 
     // Analyse the tokens..
@@ -522,22 +620,77 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
 void CppCheck::checkSimplifiedTokens(const Tokenizer &tokenizer)
 {
     // call all "runSimplifiedChecks" in all registered Check classes
-    for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
-        if (_settings.terminated())
-            return;
+    if (!runChecksInParts(tokenizer, true)) {
+        for (std::list<Check *>::const_iterator it = _checks.begin(); it != _checks.end(); ++it) {
+            if (_settings.terminated())
+                return;
 
-        if (tokenizer.isMaxTime())
-            return;
+            if (tokenizer.isMaxTime())
+                return;
 
-        Timer timerSimpleChecks((*it)->name() + "::runSimplifiedChecks", _settings.showtime, &S_timerResults);
-        (*it)->runSimplifiedChecks(&tokenizer, &_settings, this);
-        timerSimpleChecks.Stop();
+            Timer timerSimpleChecks((*it)->name() + "::runSimplifiedChecks", _settings.showtime, &S_timerResults);
+            (*it)->runSimplifiedChecks(&tokenizer, &_settings, this);
+            timerSimpleChecks.Stop();
+        }
     }
 
     if (!_settings.terminated())
         executeRules("simple", tokenizer);
 }
 
+void CppCheck::findEnabledChecks()
+{
+    // The error lists only depend on the library functions with a warning
+    std::vector<std::string> functionwarn;
+    for (std::map<std::string, Library::WarnInfo>::const_iterator it = _settings.library.functionwarn.begin(); it != _settings.library.functionwarn.end(); ++it)
+        functionwarn.push_back(it->first + ' ' + Severity::toString(it->second.severity));
+    if (_listedErrors.size() != Check::instances().size() || functionwarn != _listedFunctionwarn) {
+        _listedErrors.clear();
+        for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it)
+            _listedErrors.push_back((*it)->listedErrors(_settings));
+        _listedFunctionwarn.swap(functionwarn);
+    }
+
+    // Suppressions that are never matched are reported with --enable=information
+    const bool skipSuppressed = _useGlobalSuppressions && !_settings.isEnabled(Settings::INFORMATION);
+
+    _checks.clear();
+    std::size_t c = 0;
+    for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it, ++c) {
+        // Run the check if it does not list its errors
+        const Check::ErrorIds &errors = _listedErrors[c];
+        bool enabled = errors.empty();
+        for (std::size_t i = 0; i < errors.size() && !enabled; ++i) {
+            const Severity::SeverityType severity = errors[i].second;
+            if (!_settings.isEnabled(severity) && !(severity == Severity::debug && _settings.debugwarnings))
+                continue;
+            enabled = !skipSuppressed || !_settings.nomsg.isSuppressedEverywhere(errors[i].first);
+        }
+        if (enabled)
+            _checks.push_back(*it);
+    }
+}
+
+bool CppCheck::needsSimplifiedTokens(const Tokenizer &tokenizer) const
+{
+    // --debug prints the simplified token list
+    if (_settings.debug)
+        return true;
+
+#ifdef HAVE_RULES
+    for (std::list<Settings::Rule>::const_iterator it = _settings.rules.begin(); it != _settings.rules.end(); ++it) {
+        if (it->tokenlist == "simple")
+            return true;
+    }
+#endif
+
+    for (std::list<Check *>::const_iterator it = _checks.begin(); it != _checks.end(); ++it) {
+        if ((*it)->needsSimplifiedTokens(&tokenizer, &_settings))
+            return true;
+    }
+    return false;
+}
+
 void CppCheck::executeRules(const std::string &tokenlist, const Tokenizer &tokenizer)
 {
     (void)tokenlist;
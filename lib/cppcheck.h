@@ -33,12 +33,37 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
+class CppCheck;
 class Tokenizer;
 
 /// @addtogroup Core
 /// @{
 
+/**
+ * @brief Runs the checks of one file in parts (--function-jobs). The
+ * library does not start processes or threads itself, the CLI implements
+ * this interface with child processes.
+ */
+class CPPCHECKLIB PartsExecutor {
+public:
+    virtual ~PartsExecutor() {
+    }
+
+    /**
+     * @brief Call CppCheck::runChecksOfPart() for each part
+     * @param cppcheck the CppCheck instance that checks the file
+     * @param tokenizer tokenizer
+     * @param simplified run the checks for the simplified token list
+     * @param parts number of parts
+     * @param errorLogger the errors of all parts are reported here, in the order of the parts
+     * @param failure set if a part did not finish or its output was lost
+     * @return false if the checks were not run
+     */
+    virtual bool run(CppCheck &cppcheck, const Tokenizer &tokenizer, bool simplified, std::size_t parts, ErrorLogger &errorLogger, std::string *failure) = 0;
+};
+
 /**
  * @brief This is the base class which will use other classes to do
  * static code analysis for C and C++ code to find possible
@@ -142,6 +167,21 @@ public:
      * and if it's possible at all */
     bool isUnusedFunctionCheckEnabled() const;
 
+    /** @brief Set the executor that runs the parts of --function-jobs. Without it the checks run in one part. */
+    void setPartsExecutor(PartsExecutor *partsExecutor) {
+        _partsExecutor = partsExecutor;
+    }
+
+    /**
+     * @brief Run the checks for one part of the function scopes. The checks
+     * that can not split the function scopes run in the first part.
+     * @param tokenizer tokenizer
+     * @param simplified run the checks for the simplified token list
+     * @param part index of the part
+     * @param errorLogger the errors are reported here
+     */
+    void runChecksOfPart(const Tokenizer &tokenizer, bool simplified, std::size_t part, ErrorLogger &errorLogger);
+
 private:
 
     /** @brief There has been an internal error => Report information message */
@@ -174,6 +214,27 @@ private:
      */
     void checkSimplifiedTokens(const Tokenizer &tokenizer);
 
+    /**
+     * @brief Run the checks in parts that each get a part of the function
+     * scopes (--function-jobs)
+     * @param tokenizer tokenizer
+     * @param simplified run the checks for the simplified token list
+     * @return false if the checks were not run
+     */
+    bool runChecksInParts(const Tokenizer &tokenizer, bool simplified);
+
+    /**
+     * @brief Find the Check classes that can report an error that is enabled
+     * and not suppressed everywhere. The other Check classes are not run.
+     */
+    void findEnabledChecks();
+
+    /**
+     * @brief Is the simplified token list needed by any enabled check or rule?
+     * @param tokenizer
+     */
+    bool needsSimplifiedTokens(const Tokenizer &tokenizer) const;
+
     /**
      * @brief Execute rules, if any
      * @param tokenlist token list to use (normal / simple)
@@ -222,6 +283,25 @@ private:
     /** Simplify code? true by default */
     bool _simplify;
 
+    /** Check classes that are run, see findEnabledChecks() */
+    std::list<Check *> _checks;
+
+    /**
+     * Check::listedErrors() of each check in Check::instances(). They are
+     * computed again when the registered checks or the library functions
+     * with a warning change, see findEnabledChecks().
+     */
+    std::vector<Check::ErrorIds> _listedErrors;
+
+    /** The library functions with a warning when _listedErrors was computed */
+    std::vector<std::string> _listedFunctionwarn;
+
+    /** Runs the parts of --function-jobs, see setPartsExecutor() */
+    PartsExecutor *_partsExecutor;
+
+    /** The end of each part of the function scopes, see runChecksInParts() */
+    std::vector<std::size_t> _partEnd;
+
     /** File info used for whole program analysis */
     std::list<Check::FileInfo*> fileInfo;
 
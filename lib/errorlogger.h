@@ -377,6 +377,42 @@ public:
     }
 };
 
+/**
+ * @brief Progress reporting for loops that run once per token.
+ *
+ * Only every ProgressReporter::interval'th call is forwarded to
+ * ErrorLogger::reportProgress(), so that the hot loops pay for a counter
+ * increment instead of a virtual call (that reads the clock) per token.
+ */
+class CPPCHECKLIB ProgressReporter {
+public:
+    enum { interval = 1024 };
+
+    /**
+     * @param errorLogger where the progress is reported. Use nullptr when
+     *        progress is not reported.
+     * @param filename main file that is checked
+     * @param stage for example preprocess / tokenize / simplify / check
+     */
+    ProgressReporter(ErrorLogger *errorLogger, const std::string &filename, const char stage[])
+        : _errorLogger(errorLogger), _filename(filename), _stage(stage), _count(0) {
+    }
+
+    /** @param value progress value (0-100) */
+    void report(std::size_t value) {
+        if (_errorLogger && ++_count >= interval) {
+            _count = 0;
+            _errorLogger->reportProgress(_filename, _stage, value);
+        }
+    }
+
+private:
+    ErrorLogger * const _errorLogger;
+    const std::string &_filename;
+    const char * const _stage;
+    unsigned int _count;
+};
+
 /// @}
 //---------------------------------------------------------------------------
 #endif // errorloggerH
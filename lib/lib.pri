@@ -32,6 +32,7 @@ HEADERS += $${PWD}/check.h \
            $${PWD}/checkunusedfunctions.h \
            $${PWD}/checkunusedvar.h \
            $${PWD}/checkvaarg.h \
+           $${PWD}/controlflow.h \
            $${PWD}/cppcheck.h \
            $${PWD}/errorlogger.h \
            $${PWD}/importproject.h \
@@ -49,6 +50,7 @@ HEADERS += $${PWD}/check.h \
            $${PWD}/token.h \
            $${PWD}/tokenize.h \
            $${PWD}/tokenlist.h \
+           $${PWD}/tokenvisitor.h \
            $${PWD}/valueflow.h \
 
 
@@ -80,6 +82,7 @@ SOURCES += $${PWD}/analyzerinfo.cpp \
            $${PWD}/checkunusedfunctions.cpp \
            $${PWD}/checkunusedvar.cpp \
            $${PWD}/checkvaarg.cpp \
+           $${PWD}/controlflow.cpp \
            $${PWD}/cppcheck.cpp \
            $${PWD}/errorlogger.cpp \
            $${PWD}/importproject.cpp \
@@ -97,4 +100,5 @@ SOURCES += $${PWD}/analyzerinfo.cpp \
            $${PWD}/token.cpp \
            $${PWD}/tokenize.cpp \
            $${PWD}/tokenlist.cpp \
+           $${PWD}/tokenvisitor.cpp \
            $${PWD}/valueflow.cpp
@@ -27,6 +27,7 @@ Settings::Settings()
       debug(false),
       debugnormal(false),
       debugwarnings(false),
+      debugSimplifyRules(false),
       dump(false),
       exceptionHandling(false),
       inconclusive(false),
@@ -40,6 +41,7 @@ Settings::Settings()
       xml(false), xml_version(1),
       jobs(1),
       loadAverage(0),
+      functionJobs(1),
       exitCode(0),
       showtime(SHOWTIME_NONE),
       preprocessOnly(false),
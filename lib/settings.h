@@ -82,6 +82,9 @@ public:
     /** @brief Is --debug-warnings given? */
     bool debugwarnings;
 
+    /** @brief Is --debug-simplify-rules given? */
+    bool debugSimplifyRules;
+
     /** @brief Is --dump given? */
     bool dump;
 
@@ -151,6 +154,10 @@ public:
     /** @brief Load average value */
     unsigned int loadAverage;
 
+    /** @brief How many processes should run the checks on the functions
+        of one file. Default is 1. (--function-jobs=N) */
+    unsigned int functionJobs;
+
     /** @brief If errors are found, this value is returned from main().
         Default value is 0. */
     int exitCode;
@@ -159,7 +166,7 @@ public:
         e.g. "{severity} {file}:{line} {message} {id}" */
     std::string outputFormat;
 
-    /** @brief show timing information (--showtime=file|summary|top5) */
+    /** @brief show timing information (--showtime=file|summary|top5|tree) */
     SHOWTIME_MODES showtime;
 
     /** @brief Using -E for debugging purposes */
@@ -217,6 +217,12 @@ bool Suppressions::FileMatcher::isSuppressedLocal(const std::string &file, unsig
     return false;
 }
 
+bool Suppressions::FileMatcher::isSuppressedEverywhere() const
+{
+    const std::map<std::string, std::map<unsigned int, bool> >::const_iterator g = _globs.find("*");
+    return g != _globs.end() && g->second.find(0U) != g->second.end();
+}
+
 std::string Suppressions::addSuppression(const std::string &errorId, const std::string &file, unsigned int line)
 {
     // Check that errorId is valid..
@@ -263,6 +269,16 @@ bool Suppressions::isSuppressedLocal(const std::string &errorId, const std::stri
     return suppression->second.isSuppressedLocal(file, line);
 }
 
+bool Suppressions::isSuppressedEverywhere(const std::string &errorId) const
+{
+    std::map<std::string, FileMatcher>::const_iterator suppression = _suppressions.find("*");
+    if (errorId != "unmatchedSuppression" && suppression != _suppressions.end() && suppression->second.isSuppressedEverywhere())
+        return true;
+
+    suppression = _suppressions.find(errorId);
+    return suppression != _suppressions.end() && suppression->second.isSuppressedEverywhere();
+}
+
 std::list<Suppressions::SuppressionEntry> Suppressions::getUnmatchedLocalSuppressions(const std::string &file, const bool unusedFunctionChecking) const
 {
     std::list<SuppressionEntry> result;
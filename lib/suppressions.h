@@ -73,6 +73,12 @@ private:
          * @return true if this filename/line matches
          */
         bool isSuppressedLocal(const std::string &file, unsigned int line);
+
+        /**
+         * @brief Returns true if all lines of all files are suppressed.
+         * @return true if the glob "*" was added without line number
+         */
+        bool isSuppressedEverywhere() const;
     };
 
     /** @brief List of error which the user doesn't want to see. */
@@ -120,6 +126,15 @@ public:
      */
     bool isSuppressedLocal(const std::string &errorId, const std::string &file, unsigned int line);
 
+    /**
+     * @brief Returns true if this error is suppressed in all files, i.e. it
+     * was suppressed without file name. Unlike isSuppressed() this does not
+     * mark the suppression as matched.
+     * @param errorId the id for the error, e.g. "arrayIndexOutOfBounds"
+     * @return true if this error is never shown.
+     */
+    bool isSuppressedEverywhere(const std::string &errorId) const;
+
     struct SuppressionEntry {
         SuppressionEntry(const std::string &aid, const std::string &afile, unsigned int aline)
             : id(aid), file(afile), line(aline) {
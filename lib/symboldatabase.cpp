@@ -74,12 +74,11 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
     std::map<const Scope*, AccessControl> access;
 
     // find all scopes
+    ProgressReporter progress(_settings->reportProgress ? _errorLogger : nullptr,
+                              _tokenizer->list.getSourceFilePath(), "SymbolDatabase");
     for (const Token *tok = _tokenizer->tokens(); tok; tok = tok ? tok->next() : nullptr) {
         // #5593 suggested to add here:
-        if (_errorLogger)
-            _errorLogger->reportProgress(_tokenizer->list.getSourceFilePath(),
-                                         "SymbolDatabase",
-                                         tok->progressValue());
+        progress.report(tok->progressValue());
         // Locate next class
         if ((_tokenizer->isCPP() && ((Token::Match(tok, "class|struct|union|namespace ::| %name% {|:|::|<") && tok->strAt(-1) != "friend") ||
                                      (Token::Match(tok, "enum class| %name% {") || Token::Match(tok, "enum class| %name% : %name% {"))))
@@ -166,9 +165,14 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
                     if (!new_type) {
                         typeList.push_back(Type(new_scope->classDef, new_scope, scope));
                         new_type = &typeList.back();
-                        scope->definedTypes.push_back(new_type);
-                    } else
+                        scope->addDefinedType(new_type);
+                    } else {
+                        // a forward declared enum class gets its name from the scope
+                        const std::string name(new_type->name());
                         new_type->classScope = new_scope;
+                        if (new_type->name() != name)
+                            const_cast<Scope *>(new_type->enclosingScope)->reindexDefinedTypes();
+                    }
                     new_scope->definedType = new_type;
                 }
 
@@ -196,13 +200,13 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
 
                 if (new_scope->type == Scope::eEnum) {
                     tok2 = new_scope->addEnum(tok, _tokenizer->isCPP());
-                    scope->nestedList.push_back(new_scope);
+                    scope->addNestedScope(new_scope);
 
                     if (!tok2)
                         _tokenizer->syntaxError(tok);
                 } else {
                     // make the new scope the current scope
-                    scope->nestedList.push_back(new_scope);
+                    scope->addNestedScope(new_scope);
                     scope = new_scope;
                 }
 
@@ -232,7 +236,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
             }
 
             // make the new scope the current scope
-            scope->nestedList.push_back(new_scope);
+            scope->addNestedScope(new_scope);
             scope = &scopeList.back();
 
             tok = tok2;
@@ -244,7 +248,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
             if (!findType(tok->next(), scope)) {
                 // fill typeList..
                 typeList.push_back(Type(tok, 0, scope));
-                scope->definedTypes.push_back(&typeList.back());
+                scope->addDefinedType(&typeList.back());
             }
             tok = tok->tokAt(2);
         }
@@ -286,7 +290,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
 
             typeList.push_back(Type(tok, new_scope, scope));
             new_scope->definedType = &typeList.back();
-            scope->definedTypes.push_back(&typeList.back());
+            scope->addDefinedType(&typeList.back());
 
             scope->addVariable(varNameTok, tok, tok, access[scope], new_scope->definedType, scope, &_settings->library);
 
@@ -302,7 +306,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
             }
 
             // make the new scope the current scope
-            scope->nestedList.push_back(new_scope);
+            scope->addNestedScope(new_scope);
             scope = new_scope;
 
             tok = tok2;
@@ -324,7 +328,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
 
             typeList.push_back(Type(tok, new_scope, scope));
             new_scope->definedType = &typeList.back();
-            scope->definedTypes.push_back(&typeList.back());
+            scope->addDefinedType(&typeList.back());
 
             // make sure we have valid code
             if (!new_scope->classEnd) {
@@ -333,7 +337,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
             }
 
             // make the new scope the current scope
-            scope->nestedList.push_back(new_scope);
+            scope->addNestedScope(new_scope);
             scope = new_scope;
 
             tok = tok2;
@@ -342,7 +346,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
         // forward declared enum
         else if (Token::Match(tok, "enum class| %name% ;") || Token::Match(tok, "enum class| %name% : %name% ;")) {
             typeList.push_back(Type(tok, 0, scope));
-            scope->definedTypes.push_back(&typeList.back());
+            scope->addDefinedType(&typeList.back());
             tok = tok->tokAt(2);
         }
 
@@ -792,7 +796,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
                     scopeList.push_back(Scope(this, tok, scope, Scope::eTry, tok1));
 
                 tok = tok1;
-                scope->nestedList.push_back(&scopeList.back());
+                scope->addNestedScope(&scopeList.back());
                 scope = &scopeList.back();
             } else if (Token::Match(tok, "if|for|while|catch|switch (") && Token::simpleMatch(tok->next()->link(), ") {")) {
                 const Token *scopeStartTok = tok->next()->link()->next();
@@ -807,7 +811,7 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
                 } else // if (tok->str() == "switch")
                     scopeList.push_back(Scope(this, tok, scope, Scope::eSwitch, scopeStartTok));
 
-                scope->nestedList.push_back(&scopeList.back());
+                scope->addNestedScope(&scopeList.back());
                 scope = &scopeList.back();
                 if (scope->type == Scope::eFor)
                     scope->checkVariable(tok->tokAt(2), Local, &_settings->library); // check for variable declaration and add it to new scope if found
@@ -826,11 +830,11 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
 
                     if (tok2 && tok2->str() == ")" && tok2->link()->strAt(-1) == "]") {
                         scopeList.push_back(Scope(this, tok2->link()->linkAt(-1), scope, Scope::eLambda, tok));
-                        scope->nestedList.push_back(&scopeList.back());
+                        scope->addNestedScope(&scopeList.back());
                         scope = &scopeList.back();
                     } else if (!Token::Match(tok->previous(), "=|,|(|return") && !(tok->strAt(-1) == ")" && Token::Match(tok->linkAt(-1)->previous(), "=|,|(|return"))) {
                         scopeList.push_back(Scope(this, tok, scope, Scope::eUnconditional, tok));
-                        scope->nestedList.push_back(&scopeList.back());
+                        scope->addNestedScope(&scopeList.back());
                         scope = &scopeList.back();
                     } else {
                         tok = tok->link();
@@ -845,7 +849,7 @@ void SymbolDatabase::createSymbolDatabaseClassInfo()
 {
     if (!_tokenizer->isC()) {
         // fill in using info
-        for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+        for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
             for (std::list<Scope::UsingInfo>::iterator i = it->usingList.begin(); i != it->usingList.end(); ++i) {
                 // only find if not already found
                 if (i->scope == nullptr) {
@@ -861,7 +865,7 @@ void SymbolDatabase::createSymbolDatabaseClassInfo()
         }
 
         // fill in base class info
-        for (std::list<Type>::iterator it = typeList.begin(); it != typeList.end(); ++it) {
+        for (std::deque<Type>::iterator it = typeList.begin(); it != typeList.end(); ++it) {
             // finish filling in base class info
             for (unsigned int i = 0; i < it->derivedFrom.size(); ++i) {
                 const Type* found = findType(it->derivedFrom[i].nameTok, it->enclosingScope);
@@ -875,7 +879,7 @@ void SymbolDatabase::createSymbolDatabaseClassInfo()
         }
 
         // fill in friend info
-        for (std::list<Type>::iterator it = typeList.begin(); it != typeList.end(); ++it) {
+        for (std::deque<Type>::iterator it = typeList.begin(); it != typeList.end(); ++it) {
             for (std::list<Type::FriendInfo>::iterator i = it->friendList.begin(); i != it->friendList.end(); ++i) {
                 i->type = findType(i->nameStart, it->enclosingScope);
             }
@@ -887,13 +891,13 @@ void SymbolDatabase::createSymbolDatabaseClassInfo()
 void SymbolDatabase::createSymbolDatabaseVariableInfo()
 {
     // fill in variable info
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         // find variables
         it->getVariableList(&_settings->library);
     }
 
     // fill in function arguments
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         std::list<Function>::iterator func;
 
         for (func = it->functionList.begin(); func != it->functionList.end(); ++func) {
@@ -906,7 +910,7 @@ void SymbolDatabase::createSymbolDatabaseVariableInfo()
 void SymbolDatabase::createSymbolDatabaseFunctionScopes()
 {
     // fill in function scopes
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         if (it->type == Scope::eFunction)
             functionScopes.push_back(&*it);
     }
@@ -915,7 +919,7 @@ void SymbolDatabase::createSymbolDatabaseFunctionScopes()
 void SymbolDatabase::createSymbolDatabaseClassAndStructScopes()
 {
     // fill in class and struct scopes
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         if (it->isClassOrStruct())
             classAndStructScopes.push_back(&*it);
     }
@@ -924,7 +928,7 @@ void SymbolDatabase::createSymbolDatabaseClassAndStructScopes()
 void SymbolDatabase::createSymbolDatabaseFunctionReturnTypes()
 {
     // fill in function return types
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         std::list<Function>::iterator func;
 
         for (func = it->functionList.begin(); func != it->functionList.end(); ++func) {
@@ -947,7 +951,7 @@ void SymbolDatabase::createSymbolDatabaseNeedInitialization()
 {
     if (_tokenizer->isC()) {
         // For C code it is easy, as there are no constructors and no default values
-        for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+        for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
             Scope *scope = &(*it);
             if (scope->definedType)
                 scope->definedType->needInitialization = Type::True;
@@ -960,7 +964,7 @@ void SymbolDatabase::createSymbolDatabaseNeedInitialization()
         do {
             unknowns = 0;
 
-            for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+            for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
                 Scope *scope = &(*it);
 
                 if (!scope->definedType) {
@@ -1032,7 +1036,7 @@ void SymbolDatabase::createSymbolDatabaseNeedInitialization()
 
         // this shouldn't happen so output a debug warning
         if (retry == 100 && _settings->debugwarnings) {
-            for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+            for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
                 const Scope *scope = &(*it);
 
                 if (scope->isClassOrStruct() && scope->definedType->needInitialization == Type::Unknown)
@@ -1049,7 +1053,7 @@ void SymbolDatabase::createSymbolDatabaseVariableSymbolTable()
     std::fill_n(_variableList.begin(), _variableList.size(), (const Variable*)nullptr);
 
     // check all scopes for variables
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         Scope *scope = &(*it);
 
         // add all variables
@@ -1113,7 +1117,7 @@ void SymbolDatabase::createSymbolDatabaseVariableSymbolTable()
 void SymbolDatabase::createSymbolDatabaseSetScopePointers()
 {
     // Set scope pointers
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         Token* start = const_cast<Token*>(it->classStart);
         Token* end = const_cast<Token*>(it->classEnd);
         if (it->type == Scope::eGlobal) {
@@ -1128,7 +1132,7 @@ void SymbolDatabase::createSymbolDatabaseSetScopePointers()
             for (Token* tok = start->next(); tok != end; tok = tok->next()) {
                 if (tok->str() == "{") {
                     bool isEndOfScope = false;
-                    for (std::list<Scope*>::const_iterator innerScope = it->nestedList.begin(); innerScope != it->nestedList.end(); ++innerScope) {
+                    for (std::vector<Scope *>::const_iterator innerScope = it->nestedList.begin(); innerScope != it->nestedList.end(); ++innerScope) {
                         if (tok == (*innerScope)->classStart) { // Is begin of inner scope
                             tok = tok->link();
                             if (!tok || tok->next() == end || !tok->next()) {
@@ -1152,7 +1156,7 @@ void SymbolDatabase::createSymbolDatabaseSetFunctionPointers(bool firstPass)
 {
     if (firstPass) {
         // Set function definition and declaration pointers
-        for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+        for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
             for (std::list<Function>::const_iterator func = it->functionList.begin(); func != it->functionList.end(); ++func) {
                 if (func->tokenDef)
                     const_cast<Token *>(func->tokenDef)->function(&*func);
@@ -1173,7 +1177,7 @@ void SymbolDatabase::createSymbolDatabaseSetFunctionPointers(bool firstPass)
     }
 
     // Set C++ 11 delegate constructor function call pointers
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         for (std::list<Function>::const_iterator func = it->functionList.begin(); func != it->functionList.end(); ++func) {
             // look for initializer list
             if (func->type == Function::eConstructor && func->functionScope &&
@@ -1320,7 +1324,7 @@ void SymbolDatabase::createSymbolDatabaseSetVariablePointers()
 void SymbolDatabase::createSymbolDatabaseEnums()
 {
     // fill in enumerators in enum
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         if (it->type != Scope::eEnum)
             continue;
 
@@ -1330,7 +1334,7 @@ void SymbolDatabase::createSymbolDatabaseEnums()
     }
 
     // fill in enumerator values
-    for (std::list<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         if (it->type != Scope::eEnum)
             continue;
 
@@ -2104,7 +2108,7 @@ void SymbolDatabase::addClassFunction(Scope **scope, const Token **tok, const To
         path_length++;
     }
 
-    std::list<Scope>::iterator it1;
+    std::deque<Scope>::iterator it1;
 
     // search for match
     for (it1 = scopeList.begin(); it1 != scopeList.end(); ++it1) {
@@ -2249,7 +2253,7 @@ void SymbolDatabase::addNewFunction(Scope **scope, const Token **tok)
             return;
         }
 
-        (*scope)->nestedList.push_back(newScope);
+        (*scope)->addNestedScope(newScope);
         *scope = newScope;
         *tok = tok1;
     } else {
@@ -2660,7 +2664,7 @@ void SymbolDatabase::printOut(const char *title) const
     if (title)
         std::cout << "\n### " << title << " ###\n";
 
-    for (std::list<Scope>::const_iterator scope = scopeList.begin(); scope != scopeList.end(); ++scope) {
+    for (std::deque<Scope>::const_iterator scope = scopeList.begin(); scope != scopeList.end(); ++scope) {
         std::cout << "Scope: " << &*scope << " " << scope->type << std::endl;
         std::cout << "    className: " << scope->className << std::endl;
         std::cout << "    classDef: " << tokenToString(scope->classDef, _tokenizer) << std::endl;
@@ -2801,7 +2805,7 @@ void SymbolDatabase::printOut(const char *title) const
 
         std::cout << "    nestedList[" << scope->nestedList.size() << "] = (";
 
-        std::list<Scope *>::const_iterator nsi;
+        std::vector<Scope *>::const_iterator nsi;
 
         std::size_t count = scope->nestedList.size();
         for (nsi = scope->nestedList.begin(); nsi != scope->nestedList.end(); ++nsi) {
@@ -2832,7 +2836,7 @@ void SymbolDatabase::printOut(const char *title) const
         std::cout << std::endl;
     }
 
-    for (std::list<Type>::const_iterator type = typeList.begin(); type != typeList.end(); ++type) {
+    for (std::deque<Type>::const_iterator type = typeList.begin(); type != typeList.end(); ++type) {
         std::cout << "Type: " << &(*type) << std::endl;
         std::cout << "    name: " << type->name() << std::endl;
         std::cout << "    classDef: " << tokenToString(type->classDef, _tokenizer) << std::endl;
@@ -2901,7 +2905,7 @@ void SymbolDatabase::printXml(std::ostream &out) const
     out << std::setiosflags(std::ios::boolalpha);
     // Scopes..
     out << "  <scopes>" << std::endl;
-    for (std::list<Scope>::const_iterator scope = scopeList.begin(); scope != scopeList.end(); ++scope) {
+    for (std::deque<Scope>::const_iterator scope = scopeList.begin(); scope != scopeList.end(); ++scope) {
         out << "    <scope";
         out << " id=\"" << &*scope << "\"";
         out << " type=\"" << scope->type << "\"";
@@ -3454,12 +3458,9 @@ const Token *Scope::checkVariable(const Token *tok, AccessControl varaccess, con
 
 const Variable *Scope::getVariable(const std::string &varname) const
 {
-    std::list<Variable>::const_iterator iter;
-
-    for (iter = varlist.begin(); iter != varlist.end(); ++iter) {
-        if (iter->name() == varname)
-            return &*iter;
-    }
+    const std::multimap<std::string, const Variable *>::const_iterator it = variableMap.lower_bound(varname);
+    if (it != variableMap.end() && it->first == varname)
+        return it->second;
 
     return nullptr;
 }
@@ -3657,7 +3658,7 @@ const Enumerator * SymbolDatabase::findEnumerator(const Token * tok) const
                     return enumerator;
                 // enum
                 else {
-                    for (std::list<Scope *>::const_iterator it = scope->nestedList.begin(), end = scope->nestedList.end(); it != end; ++it) {
+                    for (std::vector<Scope *>::const_iterator it = scope->nestedList.begin(), end = scope->nestedList.end(); it != end; ++it) {
                         enumerator = (*it)->findEnumerator(tok->str());
 
                         if (enumerator)
@@ -3672,7 +3673,7 @@ const Enumerator * SymbolDatabase::findEnumerator(const Token * tok) const
         if (enumerator)
             return enumerator;
 
-        for (std::list<Scope *>::const_iterator s = scope->nestedList.begin(); s != scope->nestedList.end(); ++s) {
+        for (std::vector<Scope *>::const_iterator s = scope->nestedList.begin(); s != scope->nestedList.end(); ++s) {
             enumerator = (*s)->findEnumerator(tok->str());
 
             if (enumerator)
@@ -3701,7 +3702,7 @@ const Enumerator * SymbolDatabase::findEnumerator(const Token * tok) const
             if (enumerator)
                 return enumerator;
 
-            for (std::list<Scope*>::const_iterator s = scope->nestedList.begin(); s != scope->nestedList.end(); ++s) {
+            for (std::vector<Scope *>::const_iterator s = scope->nestedList.begin(); s != scope->nestedList.end(); ++s) {
                 enumerator = (*s)->findEnumerator(tok->str());
 
                 if (enumerator)
@@ -3836,7 +3837,7 @@ const Type* SymbolDatabase::findVariableType(const Scope *start, const Token *ty
 
 bool Scope::hasInlineOrLambdaFunction() const
 {
-    for (std::list<Scope*>::const_iterator it = nestedList.begin(); it != nestedList.end(); ++it) {
+    for (std::vector<Scope *>::const_iterator it = nestedList.begin(); it != nestedList.end(); ++it) {
         const Scope *s = *it;
         // Inline function
         if (s->type == Scope::eUnconditional && Token::simpleMatch(s->classStart->previous(), ") {"))
@@ -4282,7 +4283,7 @@ const Function* SymbolDatabase::findFunction(const Token *tok) const
 
 const Scope *SymbolDatabase::findScopeByName(const std::string& name) const
 {
-    for (std::list<Scope>::const_iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
+    for (std::deque<Scope>::const_iterator it = scopeList.begin(); it != scopeList.end(); ++it) {
         if (it->className == name)
             return &*it;
     }
@@ -4293,12 +4294,9 @@ const Scope *SymbolDatabase::findScopeByName(const std::string& name) const
 
 Scope *Scope::findInNestedList(const std::string & name)
 {
-    std::list<Scope *>::iterator it;
-
-    for (it = nestedList.begin(); it != nestedList.end(); ++it) {
-        if ((*it)->className == name)
-            return (*it);
-    }
+    const std::multimap<std::string, Scope *>::const_iterator it = nestedMap.lower_bound(name);
+    if (it != nestedMap.end() && it->first == name)
+        return it->second;
     return 0;
 }
 
@@ -4306,11 +4304,11 @@ Scope *Scope::findInNestedList(const std::string & name)
 
 const Scope *Scope::findRecordInNestedList(const std::string & name) const
 {
-    std::list<Scope *>::const_iterator it;
+    std::pair<std::multimap<std::string, Scope *>::const_iterator, std::multimap<std::string, Scope *>::const_iterator> range = nestedMap.equal_range(name);
 
-    for (it = nestedList.begin(); it != nestedList.end(); ++it) {
-        if ((*it)->className == name && (*it)->type != eFunction)
-            return (*it);
+    for (std::multimap<std::string, Scope *>::const_iterator it = range.first; it != range.second; ++it) {
+        if (it->second->type != eFunction)
+            return it->second;
     }
     return 0;
 }
@@ -4319,28 +4317,31 @@ const Scope *Scope::findRecordInNestedList(const std::string & name) const
 
 const Type* Scope::findType(const std::string & name) const
 {
-    std::list<Type*>::const_iterator it;
-
-    for (it = definedTypes.begin(); it != definedTypes.end(); ++it) {
-        if ((*it)->name() == name)
-            return (*it);
-    }
+    const std::multimap<std::string, Type *>::const_iterator it = definedTypesMap.lower_bound(name);
+    if (it != definedTypesMap.end() && it->first == name)
+        return it->second;
     return 0;
 }
 
 //---------------------------------------------------------------------------
 
-Scope *Scope::findInNestedListRecursive(const std::string & name)
+void Scope::reindexDefinedTypes()
 {
-    std::list<Scope *>::iterator it;
+    definedTypesMap.clear();
+    for (std::vector<Type *>::const_iterator it = definedTypes.begin(); it != definedTypes.end(); ++it)
+        definedTypesMap.insert(std::make_pair((*it)->name(), *it));
+}
 
-    for (it = nestedList.begin(); it != nestedList.end(); ++it) {
-        if ((*it)->className == name)
-            return (*it);
-    }
+//---------------------------------------------------------------------------
+
+Scope *Scope::findInNestedListRecursive(const std::string & name)
+{
+    Scope *child = findInNestedList(name);
+    if (child)
+        return child;
 
-    for (it = nestedList.begin(); it != nestedList.end(); ++it) {
-        Scope *child = (*it)->findInNestedListRecursive(name);
+    for (std::vector<Scope *>::iterator it = nestedList.begin(); it != nestedList.end(); ++it) {
+        child = (*it)->findInNestedListRecursive(name);
         if (child)
             return child;
     }
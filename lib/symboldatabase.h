@@ -27,6 +27,7 @@
 #include "token.h"
 
 #include <cstddef>
+#include <deque>
 #include <list>
 #include <map>
 #include <set>
@@ -896,14 +897,17 @@ public:
     std::list<Function> functionList;
     std::multimap<std::string, const Function *> functionMap;
     std::list<Variable> varlist;
+    std::multimap<std::string, const Variable *> variableMap;
     const Scope *nestedIn;
-    std::list<Scope *> nestedList;
+    std::vector<Scope *> nestedList;
+    std::multimap<std::string, Scope *> nestedMap;
     unsigned int numConstructors;
     unsigned int numCopyOrMoveConstructors;
     std::list<UsingInfo> usingList;
     ScopeType type;
     Type* definedType;
-    std::list<Type*> definedTypes;
+    std::vector<Type *> definedTypes;
+    std::multimap<std::string, Type *> definedTypesMap;
 
     // function specific fields
     const Scope *functionOf; // scope this function belongs to
@@ -965,6 +969,9 @@ public:
         return const_cast<Type*>(const_cast<const Scope *>(this)->findType(name));
     }
 
+    /** @brief update definedTypesMap after the name of a type has changed */
+    void reindexDefinedTypes();
+
     /**
      * @brief find if name is in nested list
      * @param name name of nested scope
@@ -977,6 +984,20 @@ public:
         varlist.push_back(Variable(token_, start_, end_, varlist.size(),
                                    access_,
                                    type_, scope_, lib));
+
+        variableMap.insert(make_pair(varlist.back().name(), &varlist.back()));
+    }
+
+    void addNestedScope(Scope *scope) {
+        nestedList.push_back(scope);
+
+        nestedMap.insert(make_pair(scope->className, scope));
+    }
+
+    void addDefinedType(Type *type_) {
+        definedTypes.push_back(type_);
+
+        definedTypesMap.insert(make_pair(type_->name(), type_));
     }
 
     /** @brief initialize varlist */
@@ -1073,7 +1094,7 @@ public:
     ~SymbolDatabase();
 
     /** @brief Information about all namespaces/classes/structrues */
-    std::list<Scope> scopeList;
+    std::deque<Scope> scopeList;
 
     /** @brief Fast access to function scopes */
     std::vector<const Scope *> functionScopes;
@@ -1082,7 +1103,7 @@ public:
     std::vector<const Scope *> classAndStructScopes;
 
     /** @brief Fast access to types */
-    std::list<Type> typeList;
+    std::deque<Type> typeList;
 
     /**
      * @brief find a variable type if it's a user defined type
@@ -1203,7 +1224,7 @@ private:
     std::vector<const Variable *> _variableList;
 
     /** list for missing types */
-    std::list<Type> _blankTypes;
+    std::deque<Type> _blankTypes;
 
     bool cpp;
     ValueType::Sign defaultSignedness;
@@ -1230,6 +1230,7 @@ bool TemplateSimplifier::simplifyTemplateInstantiations(
     const Token *tok,
     const std::time_t maxtime,
     std::list<Token *> &templateInstantiations,
+    std::unordered_set<std::string> &instantiationNames,
     std::set<std::string> &expandedtemplates)
 {
     // this variable is not used at the moment. The intention was to
@@ -1260,18 +1261,32 @@ bool TemplateSimplifier::simplifyTemplateInstantiations(
     // name of template function/class..
     const std::string name(tok->strAt(namepos));
 
+    // no usage of this template
+    if (instantiationNames.find(name) == instantiationNames.end())
+        return false;
+
     const bool isfunc(tok->strAt(namepos + 1) == "(");
 
     // locate template usage..
     std::string::size_type numberOfTemplateInstantiations = templateInstantiations.size();
     unsigned int recursiveCount = 0;
 
+    // last token before the code that has been expanded since the last calculation simplification
+    Token *expandedAfter = nullptr;
+
     bool instantiated = false;
 
+    ProgressReporter progress((_settings->reportProgress && !tokenlist.getFiles().empty()) ? errorlogger : nullptr,
+                              tokenlist.getSourceFilePath(), "TemplateSimplifier::simplifyTemplateInstantiations()");
+
     for (std::list<Token *>::const_iterator iter2 = templateInstantiations.begin(); iter2 != templateInstantiations.end(); ++iter2) {
         if (numberOfTemplateInstantiations != templateInstantiations.size()) {
             numberOfTemplateInstantiations = templateInstantiations.size();
-            simplifyCalculations(tokenlist.front());
+            // only the expanded code can contain new calculations
+            if (expandedAfter) {
+                simplifyCalculations(expandedAfter);
+                expandedAfter = nullptr;
+            }
             ++recursiveCount;
             if (recursiveCount > 100) {
                 // bail out..
@@ -1279,8 +1294,9 @@ bool TemplateSimplifier::simplifyTemplateInstantiations(
             }
         }
         Token * const tok2 = *iter2;
-        if (errorlogger && !tokenlist.getFiles().empty())
-            errorlogger->reportProgress(tokenlist.getFiles()[0], "TemplateSimplifier::simplifyTemplateInstantiations()", tok2->progressValue());
+        if (tok2->str() != name)
+            continue;
+        progress.report(tok2->progressValue());
 #ifdef MAXTIME
         if (std::time(0) > maxtime)
             return false;
@@ -1288,8 +1304,6 @@ bool TemplateSimplifier::simplifyTemplateInstantiations(
         (void)maxtime;
 #endif
         assert(tokenlist.validateToken(tok2)); // that assertion fails on examples from #6021
-        if (tok2->str() != name)
-            continue;
 
         if (Token::Match(tok2->previous(), "[;{}=]") &&
             !TemplateSimplifier::instantiateMatch(*iter2, name, typeParametersInDeclaration.size(), isfunc ? "(" : "*| %name%"))
@@ -1354,7 +1368,14 @@ bool TemplateSimplifier::simplifyTemplateInstantiations(
 
         if (expandedtemplates.find(newName) == expandedtemplates.end()) {
             expandedtemplates.insert(newName);
+            if (!expandedAfter)
+                expandedAfter = tokenlist.back();
+            const std::list<Token *>::size_type oldSize = templateInstantiations.size();
             TemplateSimplifier::expandTemplate(tokenlist, tok,name,typeParametersInDeclaration,newName,typesUsedInTemplateInstantiation,templateInstantiations);
+            // expandTemplate() appends the new template usages
+            std::list<Token *>::const_reverse_iterator it = templateInstantiations.rbegin();
+            for (std::list<Token *>::size_type i = oldSize; i < templateInstantiations.size(); ++i, ++it)
+                instantiationNames.insert((*it)->str());
             instantiated = true;
         }
 
@@ -1470,6 +1491,10 @@ void TemplateSimplifier::simplifyTemplates(
     // Template arguments with default values
     TemplateSimplifier::useDefaultArgumentValues(templates, &templateInstantiations);
 
+    std::unordered_set<std::string> instantiationNames;
+    for (std::list<Token *>::const_iterator it = templateInstantiations.begin(); it != templateInstantiations.end(); ++it)
+        instantiationNames.insert((*it)->str());
+
     // expand templates
     //bool done = false;
     //while (!done)
@@ -1483,6 +1508,7 @@ void TemplateSimplifier::simplifyTemplates(
                                 *iter1,
                                 maxtime,
                                 templateInstantiations,
+                                instantiationNames,
                                 expandedtemplates);
             if (instantiated)
                 templates2.push_back(*iter1);
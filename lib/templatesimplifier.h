@@ -28,6 +28,7 @@
 #include <list>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 class ErrorLogger;
@@ -141,6 +142,7 @@ public:
      * @param tok token where the template declaration begins
      * @param maxtime time when the simplification will stop
      * @param templateInstantiations a list of template usages (not necessarily just for this template)
+     * @param instantiationNames names of all tokens that have been added to templateInstantiations
      * @param expandedtemplates all templates that has been expanded so far. The full names are stored.
      * @return true if the template was instantiated
      */
@@ -151,6 +153,7 @@ public:
         const Token *tok,
         const std::time_t maxtime,
         std::list<Token *> &templateInstantiations,
+        std::unordered_set<std::string> &instantiationNames,
         std::set<std::string> &expandedtemplates);
 
     /**
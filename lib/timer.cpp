@@ -18,8 +18,11 @@
 
 #include "timer.h"
 
+#include "tokenlist.h"
+
 #include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <utility>
 #include <vector>
 /*
@@ -37,6 +40,16 @@ namespace {
     {
         return lhs.second.seconds() > rhs.second.seconds();
     }
+
+    void showResult(const dataElementType& result, bool showTokenDelta)
+    {
+        const double sec = result.second.seconds();
+        const double secAverage = sec / (double)(result.second._numberOfResults);
+        std::cout << result.first << ": " << sec << "s (avg. " << secAverage << "s - " << result.second._numberOfResults  << " result(s)";
+        if (showTokenDelta && result.second._tokenDelta != 0)
+            std::cout << ", " << (result.second._tokenDelta > 0 ? "+" : "") << result.second._tokenDelta << " tokens";
+        std::cout << ")" << std::endl;
+    }
 }
 
 void TimerResults::ShowResults(SHOWTIME_MODES mode) const
@@ -45,41 +58,97 @@ void TimerResults::ShowResults(SHOWTIME_MODES mode) const
         return;
 
     std::cout << std::endl;
-    TimerResultsData overallData;
 
-    std::vector<dataElementType> data(_results.begin(), _results.end());
-    std::sort(data.begin(), data.end(), more_second_sec);
+    if (mode == SHOWTIME_TREE) {
+        ShowTree(emptyString, 0);
+    } else {
+        std::vector<dataElementType> data(_results.begin(), _results.end());
+        std::sort(data.begin(), data.end(), more_second_sec);
 
-    size_t ordinal = 1; // maybe it would be nice to have an ordinal in output later!
-    for (std::vector<dataElementType>::const_iterator iter=data.begin() ; iter!=data.end(); ++iter) {
-        const double sec = iter->second.seconds();
-        const double secAverage = sec / (double)(iter->second._numberOfResults);
-        overallData._clocks += iter->second._clocks;
-        if ((mode != SHOWTIME_TOP5) || (ordinal<=5)) {
-            std::cout << iter->first << ": " << sec << "s (avg. " << secAverage << "s - " << iter->second._numberOfResults  << " result(s))" << std::endl;
+        size_t ordinal = 1; // maybe it would be nice to have an ordinal in output later!
+        for (std::vector<dataElementType>::const_iterator iter=data.begin() ; iter!=data.end(); ++iter) {
+            if ((mode != SHOWTIME_TOP5) || (ordinal<=5))
+                showResult(*iter, false);
+            ++ordinal;
         }
-        ++ordinal;
+    }
+
+    // nested timers are already included in the time of their parent
+    TimerResultsData overallData;
+    const std::map<std::string, std::map<std::string, struct TimerResultsData> >::const_iterator topLevel = _tree.find(emptyString);
+    if (topLevel != _tree.end()) {
+        for (std::map<std::string, struct TimerResultsData>::const_iterator iter = topLevel->second.begin(); iter != topLevel->second.end(); ++iter)
+            overallData._clocks += iter->second._clocks;
     }
 
     const double secOverall = overallData.seconds();
     std::cout << "Overall time: " << secOverall << "s" << std::endl;
 }
 
-void TimerResults::AddResults(const std::string& str, std::clock_t clocks)
+void TimerResults::ShowTree(const std::string& parent, unsigned int depth) const
+{
+    const std::map<std::string, std::map<std::string, struct TimerResultsData> >::const_iterator children = _tree.find(parent);
+    if (children == _tree.end())
+        return;
+
+    std::vector<dataElementType> data(children->second.begin(), children->second.end());
+    std::sort(data.begin(), data.end(), more_second_sec);
+
+    for (std::vector<dataElementType>::const_iterator iter=data.begin() ; iter!=data.end(); ++iter) {
+        std::cout << std::string(2U * depth, ' ');
+        showResult(*iter, true);
+        ShowTree(iter->first, depth + 1U);
+    }
+}
+
+void TimerResults::AddResults(const std::string& str, const std::string& parent, std::clock_t clocks, long tokenDelta)
 {
     _results[str]._clocks += clocks;
     _results[str]._numberOfResults++;
+    _results[str]._tokenDelta += tokenDelta;
+
+    TimerResultsData &node = _tree[parent][str];
+    node._clocks += clocks;
+    node._numberOfResults++;
+    node._tokenDelta += tokenDelta;
+}
+
+void TimerResults::AddCount(const std::string& str, const std::string& parent, long count)
+{
+    _results[str]._numberOfResults += count;
+    _tree[parent][str]._numberOfResults += count;
+}
+
+std::string TimerResults::TimerStarted(const std::string& str)
+{
+    const std::string parent = _running.empty() ? emptyString : _running.back();
+    _running.push_back(str);
+    return parent;
+}
+
+void TimerResults::TimerStopped(const std::string& str)
+{
+    const std::vector<std::string>::reverse_iterator it = std::find(_running.rbegin(), _running.rend(), str);
+    if (it != _running.rend())
+        _running.erase(std::next(it).base());
 }
 
-Timer::Timer(const std::string& str, unsigned int showtimeMode, TimerResultsIntf* timerResults)
+Timer::Timer(const std::string& str, unsigned int showtimeMode, TimerResultsIntf* timerResults, const TokenList *tokens)
     : _str(str)
     , _timerResults(timerResults)
+    , _tokens(tokens)
     , _start(0)
+    , _startTokens(0)
     , _showtimeMode(showtimeMode)
     , _stopped(false)
 {
-    if (showtimeMode != SHOWTIME_NONE)
+    if (showtimeMode != SHOWTIME_NONE) {
+        if (_timerResults)
+            _parent = _timerResults->TimerStarted(_str);
+        if (_tokens)
+            _startTokens = (long)_tokens->tokenCount();
         _start = std::clock();
+    }
 }
 
 Timer::~Timer()
@@ -92,15 +161,49 @@ void Timer::Stop()
     if ((_showtimeMode != SHOWTIME_NONE) && !_stopped) {
         const std::clock_t end = std::clock();
         const std::clock_t diff = end - _start;
+        const long tokenDelta = _tokens ? (long)_tokens->tokenCount() - _startTokens : 0;
+
+        if (_timerResults)
+            _timerResults->TimerStopped(_str);
 
         if (_showtimeMode == SHOWTIME_FILE) {
             double sec = (double)diff / CLOCKS_PER_SEC;
-            std::cout << _str << ": " << sec << "s" << std::endl;
+            std::cout << _str << ": " << sec << "s";
+            if (tokenDelta != 0)
+                std::cout << " (" << (tokenDelta > 0 ? "+" : "") << tokenDelta << " tokens)";
+            std::cout << std::endl;
         } else {
             if (_timerResults)
-                _timerResults->AddResults(_str, diff);
+                _timerResults->AddResults(_str, _parent, diff, tokenDelta);
         }
     }
 
     _stopped = true;
 }
+
+TimerSteps::TimerSteps(const std::string& str, unsigned int showtimeMode, TimerResultsIntf* timerResults, const TokenList *tokens)
+    : _str(str)
+    , _showtimeMode(showtimeMode)
+    , _timerResults(timerResults)
+    , _tokens(tokens)
+    , _timer(nullptr)
+{
+}
+
+TimerSteps::~TimerSteps()
+{
+    Stop();
+}
+
+void TimerSteps::step(const char name[])
+{
+    Stop();
+    if (_timerResults && _showtimeMode != SHOWTIME_NONE)
+        _timer = new Timer(_str + "::" + name, _showtimeMode, _timerResults, _tokens);
+}
+
+void TimerSteps::Stop()
+{
+    delete _timer;
+    _timer = nullptr;
+}
@@ -25,28 +25,63 @@
 #include <ctime>
 #include <map>
 #include <string>
+#include <vector>
+
+class TokenList;
 
 enum SHOWTIME_MODES {
     SHOWTIME_NONE = 0,
     SHOWTIME_FILE,
     SHOWTIME_SUMMARY,
-    SHOWTIME_TOP5
+    SHOWTIME_TOP5,
+    SHOWTIME_TREE
 };
 
 class CPPCHECKLIB TimerResultsIntf {
 public:
     virtual ~TimerResultsIntf() { }
 
-    virtual void AddResults(const std::string& str, std::clock_t clocks) = 0;
+    /**
+     * @param str timer name
+     * @param parent name of the enclosing timer, empty for top level timers
+     * @param clocks elapsed time
+     * @param tokenDelta change of the token count
+     */
+    virtual void AddResults(const std::string& str, const std::string& parent, std::clock_t clocks, long tokenDelta) = 0;
+
+    /**
+     * Count events that are not timed, for instance cache hits
+     * @param str counter name
+     * @param parent name of the enclosing timer
+     * @param count number of events, shown as the number of results
+     */
+    virtual void AddCount(const std::string& str, const std::string& parent, long count) = 0;
+
+    /**
+     * Called when a timer is started
+     * @param str timer name
+     * @return name of the enclosing timer, empty for top level timers
+     */
+    virtual std::string TimerStarted(const std::string& str) {
+        (void)str;
+        return emptyString;
+    }
+
+    /** Called when a timer is stopped */
+    virtual void TimerStopped(const std::string& str) {
+        (void)str;
+    }
 };
 
 struct TimerResultsData {
     std::clock_t _clocks;
     long _numberOfResults;
+    long _tokenDelta;
 
     TimerResultsData()
         : _clocks(0)
-        , _numberOfResults(0) {
+        , _numberOfResults(0)
+        , _tokenDelta(0) {
     }
 
     double seconds() const {
@@ -61,15 +96,32 @@ public:
     }
 
     void ShowResults(SHOWTIME_MODES mode) const;
-    virtual void AddResults(const std::string& str, std::clock_t clocks);
+    virtual void AddResults(const std::string& str, const std::string& parent, std::clock_t clocks, long tokenDelta);
+    virtual void AddCount(const std::string& str, const std::string& parent, long count);
+    virtual std::string TimerStarted(const std::string& str);
+    virtual void TimerStopped(const std::string& str);
 
 private:
+    void ShowTree(const std::string& parent, unsigned int depth) const;
+
     std::map<std::string, struct TimerResultsData> _results;
+
+    /** results per parent timer, used by --showtime=tree */
+    std::map<std::string, std::map<std::string, struct TimerResultsData> > _tree;
+
+    /** names of the running timers, innermost last */
+    std::vector<std::string> _running;
 };
 
 class CPPCHECKLIB Timer {
 public:
-    Timer(const std::string& str, unsigned int showtimeMode, TimerResultsIntf* timerResults = nullptr);
+    /**
+     * @param str timer name
+     * @param showtimeMode --showtime mode
+     * @param timerResults where results are added
+     * @param tokens if given, the change of the token count is reported
+     */
+    Timer(const std::string& str, unsigned int showtimeMode, TimerResultsIntf* timerResults = nullptr, const TokenList *tokens = nullptr);
     ~Timer();
     void Stop();
 
@@ -77,10 +129,38 @@ private:
     Timer& operator=(const Timer&); // disallow assignments
 
     const std::string _str;
+    std::string _parent;
     TimerResultsIntf* _timerResults;
+    const TokenList *_tokens;
     std::clock_t _start;
+    long _startTokens;
     const unsigned int _showtimeMode;
     bool _stopped;
 };
+
+/**
+ * Times consecutive steps of a pass. Each step is reported as
+ * "<name>::<step>" and is nested below the enclosing timer.
+ * Nothing is done unless timerResults is given.
+ */
+class CPPCHECKLIB TimerSteps {
+public:
+    TimerSteps(const std::string& str, unsigned int showtimeMode, TimerResultsIntf* timerResults, const TokenList *tokens = nullptr);
+    ~TimerSteps();
+
+    /** stop the current step and start the next one */
+    void step(const char name[]);
+    void Stop();
+
+private:
+    TimerSteps(const TimerSteps&); // disallow copying
+    TimerSteps& operator=(const TimerSteps&); // disallow assignments
+
+    const std::string _str;
+    const unsigned int _showtimeMode;
+    TimerResultsIntf* _timerResults;
+    const TokenList *_tokens;
+    Timer *_timer;
+};
 //---------------------------------------------------------------------------
 #endif // timerH
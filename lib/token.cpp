@@ -24,6 +24,7 @@
 #include "symboldatabase.h"
 #include "utils.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <cstring>
@@ -33,8 +34,8 @@
 #include <stack>
 #include <utility>
 
-Token::Token(Token **tokens) :
-    tokensBack(tokens),
+Token::Token(TokensFrontBack *tokens) :
+    tokensFrontBack(tokens),
     _next(0),
     _previous(0),
     _link(0),
@@ -45,6 +46,7 @@ Token::Token(Token **tokens) :
     _linenr(0),
     _col(0),
     _progressValue(0),
+    _index(0),
     _tokType(eNone),
     _flags(0),
     _astOperand1(nullptr),
@@ -54,10 +56,14 @@ Token::Token(Token **tokens) :
     valuetype(nullptr),
     _values(nullptr)
 {
+    if (tokensFrontBack)
+        ++tokensFrontBack->count;
 }
 
 Token::~Token()
 {
+    if (tokensFrontBack)
+        --tokensFrontBack->count;
     delete _originalName;
     delete valuetype;
     delete _values;
@@ -114,6 +120,7 @@ void Token::update_property_info()
     }
 
     update_property_isStandardType();
+    modified();
 }
 
 static const std::set<std::string> stdTypes =
@@ -195,8 +202,9 @@ void Token::deleteNext(unsigned long index)
 
     if (_next)
         _next->previous(this);
-    else if (tokensBack)
-        *tokensBack = this;
+    else if (tokensFrontBack)
+        tokensFrontBack->back = this;
+    modified();
 }
 
 void Token::swapWithNext()
@@ -219,6 +227,7 @@ void Token::swapWithNext()
         std::swap(_values, _next->_values);
         std::swap(valuetype, _next->valuetype);
         std::swap(_progressValue, _next->_progressValue);
+        modified();
     }
 }
 
@@ -286,6 +295,7 @@ void Token::deleteThis()
         _previous->_next = this;
 
         delete toDelete;
+        modified();
     } else {
         // We are the last token in the list, we can't delete
         // ourselves, so just make us empty
@@ -312,11 +322,12 @@ void Token::replace(Token *replaceThis, Token *start, Token *end)
     start->previous(replaceThis->previous());
     end->next(replaceThis->next());
 
-    if (end->tokensBack && *(end->tokensBack) == end) {
+    if (end->tokensFrontBack && end->tokensFrontBack->back == end) {
         while (end->next())
             end = end->next();
-        *(end->tokensBack) = end;
+        end->tokensFrontBack->back = end;
     }
+    replaceThis->modified();
 
     // Update _progressValue, fileIndex and linenr
     for (Token *tok = start; tok != end->next(); tok = tok->next())
@@ -777,6 +788,8 @@ void Token::move(Token *srcStart, Token *srcEnd, Token *newLocation)
     // Update _progressValue
     for (Token *tok = srcStart; tok != srcEnd->next(); tok = tok->next())
         tok->_progressValue = newLocation->_progressValue;
+
+    newLocation->modified();
 }
 
 Token* Token::nextArgument() const
@@ -862,10 +875,116 @@ Token * Token::findClosingBracket()
 
 //---------------------------------------------------------------------------
 
+namespace {
+    /**
+     * Cheap filter for the first element of a findmatch()/findsimplematch()
+     * pattern. When the pattern starts with a literal ("return"), a set of
+     * literal alternatives ("delete|free") or a character class ("[;{}]"),
+     * tokens that can't possibly match are rejected with a plain string
+     * compare before the full pattern is parsed.
+     */
+    class FirstTokenFilter {
+    public:
+        FirstTokenFilter(const char pattern[], bool simple) : _count(0), _chars(nullptr), _charsEnd(nullptr), _closingBracket(false) {
+            if (simple)
+                initSimple(pattern);
+            else
+                initMatch(pattern);
+        }
+
+        bool mayMatch(const Token *tok) const {
+            const std::string &str = tok->str();
+            if (_chars) {
+                if (str.size() != 1U)
+                    return false;
+                if (_closingBracket && str[0] == ']')
+                    return true;
+                return std::find(_chars, _charsEnd, str[0]) != _charsEnd;
+            }
+            if (_count == 0)
+                return true;
+            for (unsigned int i = 0; i < _count; ++i) {
+                if (str.size() == _length[i] && std::strncmp(str.c_str(), _literal[i], _length[i]) == 0)
+                    return true;
+            }
+            return false;
+        }
+
+    private:
+        void initSimple(const char pattern[]) {
+            const char *end = pattern;
+            while (*end && *end != ' ')
+                ++end;
+            if (end != pattern)
+                add(pattern, end);
+        }
+
+        void initMatch(const char pattern[]) {
+            while (*pattern == ' ')
+                ++pattern;
+            const char *end = pattern;
+            while (*end && *end != ' ')
+                ++end;
+            if (end == pattern || (pattern[0] == '!' && pattern[1] == '!'))
+                return;
+
+            // [abc] => one-character token
+            if (pattern[0] == '[' && std::find(pattern, end, ']') != end) {
+                unsigned int brackets = 0;
+                for (const char *c = pattern + 1; c != end; ++c) {
+                    if (*c == ']')
+                        ++brackets;
+                }
+                _closingBracket = (brackets > 1);
+                _chars = pattern + 1;
+                _charsEnd = end;
+                return;
+            }
+
+            // %cmd% or empty alternatives can't be filtered by text
+            if (std::find(pattern, end, '%') != end || pattern[0] == '|' || end[-1] == '|')
+                return;
+
+            const char *start = pattern;
+            for (const char *c = pattern; c != end; ++c) {
+                if (*c != '|')
+                    continue;
+                if (c == start || !add(start, c))
+                    return clear();
+                start = c + 1;
+            }
+            if (!add(start, end))
+                clear();
+        }
+
+        bool add(const char *start, const char *end) {
+            if (_count >= MaxAlternatives)
+                return false;
+            _literal[_count] = start;
+            _length[_count] = static_cast<std::size_t>(end - start);
+            ++_count;
+            return true;
+        }
+
+        void clear() {
+            _count = 0;
+        }
+
+        enum { MaxAlternatives = 8 };
+        const char *_literal[MaxAlternatives];
+        std::size_t _length[MaxAlternatives];
+        unsigned int _count;
+        const char *_chars;
+        const char *_charsEnd;
+        bool _closingBracket;
+    };
+}
+
 const Token *Token::findsimplematch(const Token * const startTok, const char pattern[])
 {
+    const FirstTokenFilter filter(pattern, true);
     for (const Token* tok = startTok; tok; tok = tok->next()) {
-        if (Token::simpleMatch(tok, pattern))
+        if (filter.mayMatch(tok) && Token::simpleMatch(tok, pattern))
             return tok;
     }
     return 0;
@@ -873,8 +992,9 @@ const Token *Token::findsimplematch(const Token * const startTok, const char pat
 
 const Token *Token::findsimplematch(const Token * const startTok, const char pattern[], const Token * const end)
 {
+    const FirstTokenFilter filter(pattern, true);
     for (const Token* tok = startTok; tok && tok != end; tok = tok->next()) {
-        if (Token::simpleMatch(tok, pattern))
+        if (filter.mayMatch(tok) && Token::simpleMatch(tok, pattern))
             return tok;
     }
     return nullptr;
@@ -882,8 +1002,9 @@ const Token *Token::findsimplematch(const Token * const startTok, const char pat
 
 const Token *Token::findmatch(const Token * const startTok, const char pattern[], const unsigned int varId)
 {
+    const FirstTokenFilter filter(pattern, false);
     for (const Token* tok = startTok; tok; tok = tok->next()) {
-        if (Token::Match(tok, pattern, varId))
+        if (filter.mayMatch(tok) && Token::Match(tok, pattern, varId))
             return tok;
     }
     return nullptr;
@@ -891,8 +1012,9 @@ const Token *Token::findmatch(const Token * const startTok, const char pattern[]
 
 const Token *Token::findmatch(const Token * const startTok, const char pattern[], const Token * const end, const unsigned int varId)
 {
+    const FirstTokenFilter filter(pattern, false);
     for (const Token* tok = startTok; tok && tok != end; tok = tok->next()) {
-        if (Token::Match(tok, pattern, varId))
+        if (filter.mayMatch(tok) && Token::Match(tok, pattern, varId))
             return tok;
     }
     return nullptr;
@@ -908,7 +1030,7 @@ void Token::insertToken(const std::string &tokenStr, const std::string &original
     if (_str.empty())
         newToken = this;
     else
-        newToken = new Token(tokensBack);
+        newToken = new Token(tokensFrontBack);
     newToken->str(tokenStr);
     if (!originalNameStr.empty())
         newToken->originalName(originalNameStr);
@@ -930,8 +1052,8 @@ void Token::insertToken(const std::string &tokenStr, const std::string &original
             if (this->next()) {
                 newToken->next(this->next());
                 newToken->next()->previous(newToken);
-            } else if (tokensBack) {
-                *tokensBack = newToken;
+            } else if (tokensFrontBack) {
+                tokensFrontBack->back = newToken;
             }
             this->next(newToken);
             newToken->previous(this);
@@ -1350,7 +1472,7 @@ void Token::printValueFlow(bool xml, std::ostream &out) const
             if (tok->_values->size() > 1U)
                 out << '{';
         }
-        for (std::list<ValueFlow::Value>::const_iterator it=tok->_values->begin(); it!=tok->_values->end(); ++it) {
+        for (std::vector<ValueFlow::Value>::const_iterator it=tok->_values->begin(); it!=tok->_values->end(); ++it) {
             if (xml) {
                 out << "      <value ";
                 switch (it->valueType) {
@@ -1423,7 +1545,7 @@ const ValueFlow::Value * Token::getValueLE(const MathLib::bigint val, const Sett
     if (!_values)
         return nullptr;
     const ValueFlow::Value *ret = nullptr;
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = _values->begin(); it != _values->end(); ++it) {
         if (it->isIntValue() && it->intvalue <= val) {
             if (!ret || ret->inconclusive || (ret->condition && !it->inconclusive))
@@ -1446,7 +1568,7 @@ const ValueFlow::Value * Token::getValueGE(const MathLib::bigint val, const Sett
     if (!_values)
         return nullptr;
     const ValueFlow::Value *ret = nullptr;
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = _values->begin(); it != _values->end(); ++it) {
         if (it->isIntValue() && it->intvalue >= val) {
             if (!ret || ret->inconclusive || (ret->condition && !it->inconclusive))
@@ -1469,7 +1591,7 @@ const ValueFlow::Value * Token::getInvalidValue(const Token *ftok, unsigned int
     if (!_values)
         return nullptr;
     const ValueFlow::Value *ret = nullptr;
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = _values->begin(); it != _values->end(); ++it) {
         if (it->isIntValue() && !settings->library.isargvalid(ftok, argnr, it->intvalue)) {
             if (!ret || ret->inconclusive || (ret->condition && !it->inconclusive))
@@ -1493,7 +1615,7 @@ const Token *Token::getValueTokenMinStrSize() const
         return nullptr;
     const Token *ret = nullptr;
     std::size_t minsize = ~0U;
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = _values->begin(); it != _values->end(); ++it) {
         if (it->isTokValue() && it->tokvalue && it->tokvalue->tokType() == Token::eString) {
             std::size_t size = getStrSize(it->tokvalue);
@@ -1512,7 +1634,7 @@ const Token *Token::getValueTokenMaxStrLength() const
         return nullptr;
     const Token *ret = nullptr;
     std::size_t maxlength = 0U;
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = _values->begin(); it != _values->end(); ++it) {
         if (it->isTokValue() && it->tokvalue && it->tokvalue->tokType() == Token::eString) {
             std::size_t length = getStrLength(it->tokvalue);
@@ -1536,7 +1658,7 @@ const Token *Token::getValueTokenDeadPointer() const
 {
     const Scope * const functionscope = getfunctionscope(this->scope());
 
-    std::list<ValueFlow::Value>::const_iterator it;
+    std::vector<ValueFlow::Value>::const_iterator it;
     for (it = values().begin(); it != values().end(); ++it) {
         // Is this a pointer alias?
         if (!it->isTokValue() || (it->tokvalue && it->tokvalue->str() != "&"))
@@ -1579,7 +1701,7 @@ bool Token::addValue(const ValueFlow::Value &value)
             return false;
 
         // if value already exists, don't add it again
-        std::list<ValueFlow::Value>::iterator it;
+        std::vector<ValueFlow::Value>::iterator it;
         for (it = _values->begin(); it != _values->end(); ++it) {
             // different intvalue => continue
             if (it->intvalue != value.intvalue)
@@ -1614,7 +1736,7 @@ bool Token::addValue(const ValueFlow::Value &value)
         ValueFlow::Value v(value);
         if (v.varId == 0)
             v.varId = _varId;
-        _values = new std::list<ValueFlow::Value>(1, v);
+        _values = new std::vector<ValueFlow::Value>(1, v);
     }
 
     return true;
@@ -1646,5 +1768,6 @@ void Token::type(const ::Type *t)
         isEnumType(_type->isEnumType());
     } else if (_tokType == eType)
         _tokType = eName;
+    modified();
 }
 
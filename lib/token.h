@@ -35,6 +35,7 @@ class Enumerator;
 class Function;
 class Scope;
 class Settings;
+class Token;
 class Type;
 class ValueType;
 class Variable;
@@ -42,6 +43,23 @@ class Variable;
 /// @addtogroup Core
 /// @{
 
+/**
+ * @brief Bookkeeping shared by all tokens of a token list.
+ *
+ * The tokens keep the last token of the list up to date and bump the
+ * modification counter whenever the text, type or order of a token
+ * changes, so the TokenList index knows when it must be rebuilt.
+ * The number of tokens is kept by the Token constructor and destructor.
+ */
+struct TokensFrontBack {
+    TokensFrontBack() : front(nullptr), back(nullptr), modifications(0), count(0) {
+    }
+    Token *front;
+    Token *back;
+    unsigned long long modifications;
+    std::size_t count;
+};
+
 /**
  * @brief The token list that the TokenList generates is a linked-list of this class.
  *
@@ -54,7 +72,7 @@ class Variable;
  */
 class CPPCHECKLIB Token {
 private:
-    Token **tokensBack;
+    TokensFrontBack *tokensFrontBack;
 
     // Not implemented..
     Token();
@@ -71,7 +89,7 @@ public:
         eNone
     };
 
-    explicit Token(Token **tokens);
+    explicit Token(TokensFrontBack *tokens);
     ~Token();
 
     template<typename T>
@@ -238,12 +256,14 @@ public:
     }
     void tokType(Token::Type t) {
         _tokType = t;
+        modified();
     }
     void isKeyword(bool kwd) {
         if (kwd)
             _tokType = eKeyword;
         else if (_tokType == eKeyword)
             _tokType = eName;
+        modified();
     }
     bool isKeyword() const {
         return _tokType == eKeyword;
@@ -504,6 +524,7 @@ public:
         if (id != 0) {
             _tokType = eVariable;
             isStandardType(false);
+            modified();
         } else {
             update_property_info();
         }
@@ -619,6 +640,7 @@ public:
             _tokType = eFunction;
         else if (_tokType == eFunction)
             _tokType = eName;
+        modified();
     }
 
     /**
@@ -638,6 +660,7 @@ public:
             _tokType = eVariable;
         else if (_tokType == eVariable)
             _tokType = eName;
+        modified();
     }
 
     /**
@@ -677,6 +700,7 @@ public:
             _tokType = eEnumerator;
         else if (_tokType == eEnumerator)
             _tokType = eName;
+        modified();
     }
 
     /**
@@ -709,6 +733,17 @@ public:
     /** Calculate progress values for all tokens */
     static void assignProgressValues(Token *tok);
 
+    /**
+     * Position in the token list. It is assigned when TokenList builds its
+     * def-use index and is not updated when tokens are added or removed.
+     */
+    unsigned int index() const {
+        return _index;
+    }
+    void index(unsigned int i) {
+        _index = i;
+    }
+
     /**
      * @return the first token of the next argument. Does only work on argument
      * lists. Requires that Tokenizer::createLinks2() has been called before.
@@ -745,8 +780,8 @@ public:
         return _originalName ? *_originalName : emptyString;
     }
 
-    const std::list<ValueFlow::Value>& values() const {
-        static const std::list<ValueFlow::Value> emptyList;
+    const std::vector<ValueFlow::Value>& values() const {
+        static const std::vector<ValueFlow::Value> emptyList;
         return _values ? *_values : emptyList;
     }
 
@@ -768,7 +803,7 @@ public:
     const ValueFlow::Value * getValue(const MathLib::bigint val) const {
         if (!_values)
             return nullptr;
-        for (std::list<ValueFlow::Value>::const_iterator it = _values->begin(); it != _values->end(); ++it) {
+        for (std::vector<ValueFlow::Value>::const_iterator it = _values->begin(); it != _values->end(); ++it) {
             if (it->isIntValue() && it->intvalue == val)
                 return &(*it);
         }
@@ -779,7 +814,7 @@ public:
         if (!_values)
             return nullptr;
         const ValueFlow::Value *ret = nullptr;
-        for (std::list<ValueFlow::Value>::const_iterator it = _values->begin(); it != _values->end(); ++it) {
+        for (std::vector<ValueFlow::Value>::const_iterator it = _values->begin(); it != _values->end(); ++it) {
             if (!it->isIntValue())
                 continue;
             if ((!ret || it->intvalue > ret->intvalue) &&
@@ -792,7 +827,7 @@ public:
     const ValueFlow::Value * getMovedValue() const {
         if (!_values)
             return nullptr;
-        for (std::list<ValueFlow::Value>::const_iterator it = _values->begin(); it != _values->end(); ++it) {
+        for (std::vector<ValueFlow::Value>::const_iterator it = _values->begin(); it != _values->end(); ++it) {
             if (it->isMovedValue() && it->moveKind != ValueFlow::Value::NonMovedVariable)
                 return &(*it);
         }
@@ -861,6 +896,9 @@ private:
      */
     unsigned int _progressValue;
 
+    /** Position in the token list, see index() */
+    unsigned int _index;
+
     Token::Type _tokType;
 
     enum {
@@ -905,6 +943,12 @@ private:
         _flags = state_ ? _flags | flag_ : _flags & ~flag_;
     }
 
+    /** Tell the token list that the text, type or position of this token changed */
+    void modified() {
+        if (tokensFrontBack)
+            ++tokensFrontBack->modifications;
+    }
+
     /** Updates internal property cache like _isName or _isBoolean.
         Called after any _str() modification. */
     void update_property_info();
@@ -924,7 +968,7 @@ private:
     ValueType *valuetype;
 
     // ValueFlow
-    std::list<ValueFlow::Value>* _values;
+    std::vector<ValueFlow::Value>* _values;
 
 public:
     void astOperand1(Token *tok);
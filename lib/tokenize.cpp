@@ -40,6 +40,7 @@
 #include <ctime>
 #include <iostream>
 #include <stack>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 //---------------------------------------------------------------------------
@@ -60,6 +61,59 @@ namespace {
         const bool isEnum;
         const unsigned int startVarid;
     };
+
+    // local class used in setVarId
+    // in order to store the variable ids that are visible in the current scope.
+    // Leaving a scope undoes the changes that were made in it instead of
+    // restoring a copy of the whole map.
+    class VariableMap {
+    public:
+        void enterScope() {
+            scopeInfo.push(std::vector<std::pair<std::string, unsigned int> >());
+        }
+
+        bool leaveScope() {
+            if (scopeInfo.empty())
+                return false;
+
+            const std::vector<std::pair<std::string, unsigned int> > &changes = scopeInfo.top();
+            for (std::vector<std::pair<std::string, unsigned int> >::const_reverse_iterator it = changes.rbegin(); it != changes.rend(); ++it) {
+                if (it->second == 0)
+                    variableId.erase(it->first);
+                else
+                    variableId[it->first] = it->second;
+            }
+            scopeInfo.pop();
+            return true;
+        }
+
+        void addVariable(const std::string &varname, unsigned int varid) {
+            unsigned int &id = variableId[varname];
+            if (!scopeInfo.empty())
+                scopeInfo.top().push_back(std::make_pair(varname, id));
+            id = varid;
+        }
+
+        bool hasVariable(const std::string &varname) const {
+            return variableId.find(varname) != variableId.end();
+        }
+
+        void clear() {
+            variableId.clear();
+        }
+
+        const std::unordered_map<std::string, unsigned int> &map() const {
+            return variableId;
+        }
+
+        std::unordered_map<unsigned int, std::unordered_map<std::string, unsigned int> > structMembers;
+
+    private:
+        std::unordered_map<std::string, unsigned int> variableId;
+
+        /** the previous variable ids (0 if there was none) of the names that are declared in each scope */
+        std::stack<std::vector<std::pair<std::string, unsigned int> > > scopeInfo;
+    };
 }
 
 /** Return whether tok is the "{" that starts an enumerator list */
@@ -140,7 +194,8 @@ Tokenizer::Tokenizer() :
     _symbolDatabase(0),
     _varId(0),
     _codeWithTemplates(false), //is there any templates?
-    m_timerResults(nullptr)
+    m_timerResults(nullptr),
+    m_analyzerInformation(nullptr)
 #ifdef MAXTIME
     ,maxtime(std::time(0) + MAXTIME)
 #endif
@@ -154,7 +209,8 @@ Tokenizer::Tokenizer(const Settings *settings, ErrorLogger *errorLogger) :
     _symbolDatabase(0),
     _varId(0),
     _codeWithTemplates(false), //is there any templates?
-    m_timerResults(nullptr)
+    m_timerResults(nullptr),
+    m_analyzerInformation(nullptr)
 #ifdef MAXTIME
     ,maxtime(std::time(0) + MAXTIME)
 #endif
@@ -566,14 +622,23 @@ Token *Tokenizer::processFunc(Token *tok2, bool inOperator) const
 
 void Tokenizer::simplifyTypedef()
 {
+    // Count the names once. A typedef name that occurs only in the typedef
+    // itself is not used, and the rest of the code is not scanned for it.
+    std::unordered_map<std::string, unsigned int> nameCount;
+    for (const Token *tok = list.front(); tok; tok = tok->next()) {
+        if (tok->isName())
+            ++nameCount[tok->str()];
+    }
+
     std::vector<Space> spaceInfo;
     bool isNamespace = false;
     std::string className;
     bool hasClass = false;
     bool goback = false;
+    ProgressReporter progress((_settings->reportProgress && !list.getFiles().empty()) ? _errorLogger : nullptr,
+                              list.getSourceFilePath(), "Tokenize (typedef)");
     for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (_errorLogger && !list.getFiles().empty())
-            _errorLogger->reportProgress(list.getFiles()[0], "Tokenize (typedef)", tok->progressValue());
+        progress.report(tok->progressValue());
 
         if (_settings->terminated())
             return;
@@ -1034,7 +1099,12 @@ void Tokenizer::simplifyTypedef()
             bool globalScope = false;
             std::size_t classLevel = spaceInfo.size();
 
-            for (Token *tok2 = tok; tok2; tok2 = tok2->next()) {
+            // Scanning a reopened namespace updates spaceInfo, so that can't be skipped
+            bool unused = nameCount[typeName->str()] <= 1U;
+            for (std::vector<Space>::const_iterator it = spaceInfo.begin(); unused && it != spaceInfo.end(); ++it)
+                unused = !it->isNamespace;
+
+            for (Token *tok2 = unused ? nullptr : tok; tok2; tok2 = tok2->next()) {
                 if (_settings->terminated())
                     return;
 
@@ -1735,18 +1805,39 @@ void Tokenizer::createTokens(const simplecpp::TokenList *tokenList)
 }
 
 bool Tokenizer::simplifyTokens1(const std::string &configuration)
+{
+    if (!simplifyTokens1Syntax(configuration))
+        return false;
+
+    simplifyTokens1Symbols();
+    return true;
+}
+
+bool Tokenizer::simplifyTokens1Syntax(const std::string &configuration)
 {
     // Fill the map _typeSize..
     fillTypeSizes();
 
     _configuration = configuration;
 
+    TimerSteps steps("Tokenizer::simplifyTokens1", _settings->showtime, m_timerResults, &list);
+
+    steps.step("simplifyTokenList1");
     if (!simplifyTokenList1(list.getFiles().front().c_str()))
         return false;
 
+    steps.step("createAst");
     list.createAst();
     list.validateAst();
 
+    return true;
+}
+
+void Tokenizer::simplifyTokens1Symbols()
+{
+    TimerSteps steps("Tokenizer::simplifyTokens1", _settings->showtime, m_timerResults, &list);
+
+    steps.step("createSymbolDatabase");
     createSymbolDatabase();
 
     // Use symbol database to identify rvalue references. Split && to & &. This is safe, since it doesn't delete any tokens (which might be referenced by symbol database)
@@ -1762,12 +1853,13 @@ bool Tokenizer::simplifyTokens1(const std::string &configuration)
         }
     }
 
+    steps.step("setValueTypeInTokenList");
     _symbolDatabase->setValueTypeInTokenList();
-    ValueFlow::setValues(&list, _symbolDatabase, _errorLogger, _settings);
+    steps.step("ValueFlow");
+    ValueFlow::setValues(&list, _symbolDatabase, _errorLogger, _settings, m_timerResults, m_analyzerInformation);
+    steps.Stop();
 
     printDebugOutput(1);
-
-    return true;
 }
 
 bool Tokenizer::tokenize(std::istream &code,
@@ -2306,7 +2398,7 @@ void Tokenizer::simplifyTemplates()
 //---------------------------------------------------------------------------
 
 
-static bool setVarIdParseDeclaration(const Token **tok, const std::map<std::string,unsigned int> &variableId, bool executableScope, bool cpp, bool c)
+static bool setVarIdParseDeclaration(const Token **tok, const VariableMap &variableId, bool executableScope, bool cpp, bool c)
 {
     const Token *tok2 = *tok;
     if (!tok2->isName())
@@ -2327,7 +2419,7 @@ static bool setVarIdParseDeclaration(const Token **tok, const std::map<std::stri
                 singleNameCount = 0;
             } else if (tok2->str() == "const") {
                 ;  // just skip "const"
-            } else if (!hasstruct && variableId.find(tok2->str()) != variableId.end() && tok2->previous()->str() != "::") {
+            } else if (!hasstruct && variableId.hasVariable(tok2->str()) && tok2->previous()->str() != "::") {
                 ++typeCount;
                 tok2 = tok2->next();
                 if (!tok2 || tok2->str() != "::")
@@ -2384,7 +2476,7 @@ static bool setVarIdParseDeclaration(const Token **tok, const std::map<std::stri
 
 
 static void setVarIdStructMembers(Token **tok1,
-                                  std::map<unsigned int, std::map<std::string, unsigned int> >& structMembers,
+                                  std::unordered_map<unsigned int, std::unordered_map<std::string, unsigned int> >& structMembers,
                                   unsigned int *_varId)
 {
     Token *tok = *tok1;
@@ -2394,7 +2486,7 @@ static void setVarIdStructMembers(Token **tok1,
         if (struct_varid == 0)
             return;
 
-        std::map<std::string, unsigned int>& members = structMembers[struct_varid];
+        std::unordered_map<std::string, unsigned int>& members = structMembers[struct_varid];
 
         tok = tok->tokAt(3);
         while (tok->str() != "}") {
@@ -2402,7 +2494,7 @@ static void setVarIdStructMembers(Token **tok1,
                 tok = tok->link();
             if (Token::Match(tok->previous(), "[,{] . %name% =")) {
                 tok = tok->next();
-                const std::map<std::string, unsigned int>::iterator it = members.find(tok->str());
+                const std::unordered_map<std::string, unsigned int>::iterator it = members.find(tok->str());
                 if (it == members.end()) {
                     members[tok->str()] = ++(*_varId);
                     tok->varId(*_varId);
@@ -2426,8 +2518,8 @@ static void setVarIdStructMembers(Token **tok1,
         if (TemplateSimplifier::templateParameters(tok->next()) > 0)
             break;
 
-        std::map<std::string, unsigned int>& members = structMembers[struct_varid];
-        const std::map<std::string, unsigned int>::iterator it = members.find(tok->str());
+        std::unordered_map<std::string, unsigned int>& members = structMembers[struct_varid];
+        const std::unordered_map<std::string, unsigned int>::iterator it = members.find(tok->str());
         if (it == members.end()) {
             members[tok->str()] = ++(*_varId);
             tok->varId(*_varId);
@@ -2441,9 +2533,9 @@ static void setVarIdStructMembers(Token **tok1,
 
 
 void Tokenizer::setVarIdClassDeclaration(const Token * const startToken,
-        const std::map<std::string, unsigned int> &variableId,
+        const std::unordered_map<std::string, unsigned int> &variableId,
         const unsigned int scopeStartVarId,
-        std::map<unsigned int, std::map<std::string,unsigned int> >& structMembers)
+        std::unordered_map<unsigned int, std::unordered_map<std::string, unsigned int> >& structMembers)
 {
     // end of scope
     const Token * const endToken = startToken->link();
@@ -2484,7 +2576,7 @@ void Tokenizer::setVarIdClassDeclaration(const Token * const startToken,
             --indentlevel;
             inEnum = false;
         } else if (initList && indentlevel == 0 && Token::Match(tok->previous(), "[,:] %name% [({]")) {
-            const std::map<std::string, unsigned int>::const_iterator it = variableId.find(tok->str());
+            const std::unordered_map<std::string, unsigned int>::const_iterator it = variableId.find(tok->str());
             if (it != variableId.end()) {
                 tok->varId(it->second);
             }
@@ -2502,7 +2594,7 @@ void Tokenizer::setVarIdClassDeclaration(const Token * const startToken,
                 }
 
                 if (!inEnum) {
-                    const std::map<std::string, unsigned int>::const_iterator it = variableId.find(tok->str());
+                    const std::unordered_map<std::string, unsigned int>::const_iterator it = variableId.find(tok->str());
                     if (it != variableId.end()) {
                         tok->varId(it->second);
                         setVarIdStructMembers(&tok, structMembers, &_varId);
@@ -2521,8 +2613,8 @@ void Tokenizer::setVarIdClassDeclaration(const Token * const startToken,
 static void setVarIdClassFunction(const std::string &classname,
                                   Token * const startToken,
                                   const Token * const endToken,
-                                  const std::map<std::string, unsigned int> &varlist,
-                                  std::map<unsigned int, std::map<std::string, unsigned int> >& structMembers,
+                                  const std::unordered_map<std::string, unsigned int> &varlist,
+                                  std::unordered_map<unsigned int, std::unordered_map<std::string, unsigned int> >& structMembers,
                                   unsigned int *_varId)
 {
     for (Token *tok2 = startToken; tok2 && tok2 != endToken; tok2 = tok2->next()) {
@@ -2535,7 +2627,7 @@ static void setVarIdClassFunction(const std::string &classname,
         if (Token::Match(tok2->tokAt(-2), "!!this .") && !Token::simpleMatch(tok2->tokAt(-5), "( * this ) ."))
             continue;
 
-        const std::map<std::string,unsigned int>::const_iterator it = varlist.find(tok2->str());
+        const std::unordered_map<std::string, unsigned int>::const_iterator it = varlist.find(tok2->str());
         if (it != varlist.end()) {
             tok2->varId(it->second);
             setVarIdStructMembers(&tok2, structMembers, _varId);
@@ -2553,10 +2645,15 @@ void Tokenizer::setVarId()
             tok->varId(0);
     }
 
+    TimerSteps steps("Tokenizer::setVarId", _settings->showtime, m_timerResults, &list);
+
+    steps.step("setPodTypes");
     setPodTypes();
 
+    steps.step("setVarIdPass1");
     setVarIdPass1();
 
+    steps.step("setVarIdPass2");
     setVarIdPass2();
 }
 
@@ -2575,9 +2672,7 @@ void Tokenizer::setVarIdPass1()
 
     // variable id
     _varId = 0;
-    std::map<std::string, unsigned int> variableId;
-    std::map<unsigned int, std::map<std::string, unsigned int> > structMembers;
-    std::stack< std::map<std::string, unsigned int> > scopeInfo;
+    VariableMap variableId;
 
     std::stack<VarIdScopeInfo> scopeStack;
 
@@ -2590,10 +2685,8 @@ void Tokenizer::setVarIdPass1()
             if (tok->str() == ":")
                 initlist = true;
             else if (tok->str() == ";") {
-                if (scopeInfo.empty())
+                if (!variableId.leaveScope())
                     cppcheckError(tok);
-                variableId.swap(scopeInfo.top());
-                scopeInfo.pop();
             } else if (tok->str() == "{")
                 scopeStack.push(VarIdScopeInfo(true, scopeStack.top().isStructInit || tok->strAt(-1) == "=", /*isEnum=*/false, _varId));
         } else if (!initlist && tok->str()=="(") {
@@ -2608,7 +2701,7 @@ void Tokenizer::setVarIdPass1()
             if (newFunctionDeclEnd &&
                 (functionDeclEndStack.empty() || newFunctionDeclEnd != functionDeclEndStack.top())) {
                 functionDeclEndStack.push(newFunctionDeclEnd);
-                scopeInfo.push(variableId);
+                variableId.enterScope();
             }
         } else if (Token::Match(tok, "{|}")) {
             const Token * const startToken = (tok->str() == "{") ? tok : tok->link();
@@ -2626,7 +2719,7 @@ void Tokenizer::setVarIdPass1()
                         isExecutable = ((scopeStack.top().isExecutable || initlist || tok->strAt(-1) == "else") &&
                                         !isClassStructUnionEnumStart(tok));
                         if (!(scopeStack.top().isStructInit || tok->strAt(-1) == "="))
-                            scopeInfo.push(variableId);
+                            variableId.enterScope();
                     }
                     initlist = false;
                     scopeStack.push(VarIdScopeInfo(isExecutable, scopeStack.top().isStructInit || tok->strAt(-1) == "=", isEnumStart(tok), _varId));
@@ -2637,18 +2730,14 @@ void Tokenizer::setVarIdPass1()
                     // Set variable ids in class declaration..
                     if (!initlist && !isC() && !scopeStack.top().isExecutable && tok->link() && !isNamespace) {
                         setVarIdClassDeclaration(tok->link(),
-                                                 variableId,
+                                                 variableId.map(),
                                                  scopeStack.top().startVarid,
-                                                 structMembers);
+                                                 variableId.structMembers);
                     }
 
                     if (!scopeStack.top().isStructInit) {
-                        if (scopeInfo.empty()) {
+                        if (!variableId.leaveScope())
                             variableId.clear();
-                        } else {
-                            variableId.swap(scopeInfo.top());
-                            scopeInfo.pop();
-                        }
                     }
 
                     scopeStack.pop();
@@ -2726,7 +2815,7 @@ void Tokenizer::setVarIdPass1()
                                     continue;
 
                                 if (tok3->isLiteral() ||
-                                    (tok3->isName() && (variableId.find(tok3->str()) != variableId.end())) ||
+                                    (tok3->isName() && variableId.hasVariable(tok3->str())) ||
                                     tok3->isOp() ||
                                     tok3->str() == "(" ||
                                     notstart.find(tok3->str()) != notstart.end()) {
@@ -2744,7 +2833,7 @@ void Tokenizer::setVarIdPass1()
                     decl = false;
 
                 if (decl) {
-                    variableId[prev2->str()] = ++_varId;
+                    variableId.addVariable(prev2->str(), ++_varId);
 
                     // set varid for template parameters..
                     tok = tok->next();
@@ -2753,8 +2842,8 @@ void Tokenizer::setVarIdPass1()
                     if (tok && tok->str() == "<") {
                         const Token *end = tok->findClosingBracket();
                         while (tok != end) {
-                            if (tok->isName() && variableId.find(tok->str()) != variableId.end())
-                                tok->varId(variableId[tok->str()]);
+                            if (tok->isName() && variableId.hasVariable(tok->str()))
+                                tok->varId(variableId.map().at(tok->str()));
                             tok = tok->next();
                         }
                     }
@@ -2809,10 +2898,10 @@ void Tokenizer::setVarIdPass1()
             }
 
             if (!scopeStack.top().isEnum) {
-                const std::map<std::string, unsigned int>::const_iterator it = variableId.find(tok->str());
-                if (it != variableId.end()) {
+                const std::unordered_map<std::string, unsigned int>::const_iterator it = variableId.map().find(tok->str());
+                if (it != variableId.map().end()) {
                     tok->varId(it->second);
-                    setVarIdStructMembers(&tok, structMembers, &_varId);
+                    setVarIdStructMembers(&tok, variableId.structMembers, &_varId);
                 }
             }
         } else if (Token::Match(tok, "::|. %name%")) {
@@ -2831,11 +2920,11 @@ void Tokenizer::setVarIdPass1()
 
 void Tokenizer::setVarIdPass2()
 {
-    std::map<unsigned int, std::map<std::string, unsigned int> > structMembers;
+    std::unordered_map<unsigned int, std::unordered_map<std::string, unsigned int> > structMembers;
 
-    // Member functions and variables in this source
-    std::list<Token *> allMemberFunctions;
-    std::list<Token *> allMemberVars;
+    // Member functions and variables in this source, by the name of the (outermost) class
+    std::unordered_map<std::string, std::list<Token *> > allMemberFunctions;
+    std::unordered_map<std::string, std::list<Token *> > allMemberVars;
     if (!isC()) {
         for (Token *tok2 = list.front(); tok2; tok2 = tok2->next()) {
             const Token* tok3 = nullptr;
@@ -2856,14 +2945,14 @@ void Tokenizer::setVarIdPass2()
                 syntaxError(tok2);
             const std::string& str3 = tok3->str();
             if (str3 == "(")
-                allMemberFunctions.push_back(tok2);
+                allMemberFunctions[tok2->str()].push_back(tok2);
             else if (str3 != "::" && tok2->strAt(-1) != "::") // Support only one depth
-                allMemberVars.push_back(tok2);
+                allMemberVars[tok2->str()].push_back(tok2);
         }
     }
 
     // class members..
-    std::map<std::string, std::map<std::string, unsigned int> > varsByClass;
+    std::unordered_map<std::string, std::unordered_map<std::string, unsigned int> > varsByClass;
     for (Token *tok = list.front(); tok; tok = tok->next()) {
         if (!Token::Match(tok, "namespace|class|struct %name% {|:|::"))
             continue;
@@ -2877,12 +2966,12 @@ void Tokenizer::setVarIdPass2()
             nestedCount++;
         }
 
-        std::map<std::string, unsigned int>& thisClassVars = varsByClass[classname];
+        std::unordered_map<std::string, unsigned int>& thisClassVars = varsByClass[classname];
         while (tokStart && tokStart->str() != "{") {
             if (Token::Match(tokStart, "public|private|protected %name%"))
                 tokStart = tokStart->next();
             if (tokStart->strAt(1) == "," || tokStart->strAt(1) == "{") {
-                const std::map<std::string, unsigned int>& baseClassVars = varsByClass[tokStart->str()];
+                const std::unordered_map<std::string, unsigned int>& baseClassVars = varsByClass[tokStart->str()];
                 thisClassVars.insert(baseClassVars.begin(), baseClassVars.end());
             }
             tokStart = tokStart->next();
@@ -2911,7 +3000,8 @@ void Tokenizer::setVarIdPass2()
             continue;
 
         // Member variables
-        for (std::list<Token *>::iterator func = allMemberVars.begin(); func != allMemberVars.end(); ++func) {
+        std::list<Token *> &memberVars = allMemberVars[tok->next()->str()];
+        for (std::list<Token *>::iterator func = memberVars.begin(); func != memberVars.end(); ++func) {
             if (!Token::simpleMatch(*func, classname.c_str()))
                 continue;
 
@@ -2924,7 +3014,8 @@ void Tokenizer::setVarIdPass2()
             continue;
 
         // Set variable ids in member functions for this class..
-        for (std::list<Token *>::iterator func = allMemberFunctions.begin(); func != allMemberFunctions.end(); ++func) {
+        std::list<Token *> &memberFunctions = allMemberFunctions[tok->next()->str()];
+        for (std::list<Token *>::iterator func = memberFunctions.begin(); func != memberFunctions.end(); ++func) {
             Token *tok2 = *func;
 
             if (!Token::Match(tok2, classname.c_str())) {
@@ -2970,7 +3061,7 @@ void Tokenizer::setVarIdPass2()
                     break;
 
                 // set varid
-                std::map<std::string, unsigned int>::const_iterator varpos = thisClassVars.find(tok3->str());
+                std::unordered_map<std::string, unsigned int>::const_iterator varpos = thisClassVars.find(tok3->str());
                 if (varpos != thisClassVars.end())
                     tok3->varId(varpos->second);
 
@@ -3329,7 +3420,10 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     if (_settings->terminated())
         return false;
 
+    TimerSteps steps("Tokenizer::simplifyTokenList1", _settings->showtime, m_timerResults, &list);
+
     // if MACRO
+    steps.step("if MACRO");
     for (Token *tok = list.front(); tok; tok = tok->next()) {
         if (Token::Match(tok, "if|for|while|BOOST_FOREACH %name% (")) {
             if (Token::simpleMatch(tok, "for each")) {
@@ -3342,20 +3436,26 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
         }
     }
 
+    steps.step("validateC");
     // Is there C++ code in C file?
     validateC();
 
+    steps.step("removeMacroInVarDecl");
     // remove MACRO in variable declaration: MACRO int x;
     removeMacroInVarDecl();
 
+    steps.step("combineStringAndCharLiterals");
     // Combine strings and character literals, e.g. L"string", L'c', "string1" "string2"
     combineStringAndCharLiterals();
 
+    steps.step("simplifySQL");
     // replace inline SQL with "asm()" (Oracle PRO*C). Ticket: #1959
     simplifySQL();
 
+    steps.step("createLinks");
     createLinks();
 
+    steps.step("simplifyAsm");
     // Remove __asm..
     simplifyAsm();
 
@@ -3363,6 +3463,7 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     if (const Token *garbage = findGarbageCode())
         syntaxError(garbage);
 
+    steps.step("checkConfiguration");
     checkConfiguration();
 
     // if (x) MACRO() ..
@@ -3380,28 +3481,36 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyDeprecated");
     // Remove [[deprecated]]
     simplifyDeprecated();
 
+    steps.step("simplifyAttribute");
     // remove __attribute__((?))
     simplifyAttribute();
 
+    steps.step("combineOperators");
     // Combine tokens..
     combineOperators();
 
+    steps.step("simplifyCAlternativeTokens");
     // Simplify the C alternative tokens (and, or, etc.)
     simplifyCAlternativeTokens();
 
+    steps.step("simplifyMathExpressions");
     // replace 'sin(0)' to '0' and other similar math expressions
     simplifyMathExpressions();
 
+    steps.step("concatenateNegativeNumberAndAnyPositive");
     // combine "- %num%"
     concatenateNegativeNumberAndAnyPositive();
 
     // remove extern "C" and extern "C" {}
+    steps.step("simplifyExternC");
     if (isCPP())
         simplifyExternC();
 
+    steps.step("simplifyRoundCurlyParentheses");
     // simplify weird but legal code: "[;{}] ( { code; } ) ;"->"[;{}] code;"
     simplifyRoundCurlyParentheses();
 
@@ -3413,9 +3522,11 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
         }
     }
 
+    steps.step("simplifyAddBraces");
     if (!simplifyAddBraces())
         return false;
 
+    steps.step("sizeofAddParentheses");
     sizeofAddParentheses();
 
     // Simplify: 0[foo] -> *(foo)
@@ -3430,6 +3541,7 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyKeyword");
     // Remove "volatile", "inline", "register", and "restrict"
     simplifyKeyword();
 
@@ -3452,16 +3564,21 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
         }
     }
 
+    steps.step("simplifyVarDecl");
     // Convert K&R function declarations to modern C
     simplifyVarDecl(true);
+    steps.step("simplifyFunctionParameters");
     simplifyFunctionParameters();
 
+    steps.step("simplifyCaseRange");
     // simplify case ranges (gcc extension)
     simplifyCaseRange();
 
+    steps.step("simplifyLabelsCaseDefault");
     // simplify labels and 'case|default'-like syntaxes
     simplifyLabelsCaseDefault();
 
+    steps.step("simplifyMulAndParens");
     // simplify '[;{}] * & ( %any% ) =' to '%any% ='
     simplifyMulAndParens();
 
@@ -3472,15 +3589,19 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyCallingConvention");
     // remove calling conventions __cdecl, __stdcall..
     simplifyCallingConvention();
 
+    steps.step("simplifyDeclspec");
     // Remove __declspec()
     simplifyDeclspec();
     validate();
+    steps.step("removeMacrosInGlobalScope");
     // remove some unhandled macros in global scope
     removeMacrosInGlobalScope();
 
+    steps.step("removeMacroInClassDef");
     // remove undefined macro in class definition:
     // class DLLEXPORT Fred { };
     // class Fred FINAL : Base { };
@@ -3489,44 +3610,46 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     // That call here fixes #7190
     validate();
 
+    steps.step("removeUnnecessaryQualification");
     // remove unnecessary member qualification..
     removeUnnecessaryQualification();
 
-    // convert Microsoft memory functions
-    simplifyMicrosoftMemoryFunctions();
-
-    // convert Microsoft string functions
-    simplifyMicrosoftStringFunctions();
+    steps.step("microsoftFunctionRules");
+    // convert Microsoft memory and string functions
+    simplifyFused(microsoftFunctionRules());
 
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyQtSignalsSlots");
     // Remove Qt signals and slots
     simplifyQtSignalsSlots();
 
+    steps.step("simplifyBorland");
     // remove Borland stuff..
     simplifyBorland();
 
+    steps.step("checkForEnumsWithTypedef");
     // syntax error: enum with typedef in it
     checkForEnumsWithTypedef();
 
+    steps.step("prepareTernaryOpForAST");
     // Add parentheses to ternary operator where necessary
     prepareTernaryOpForAST();
 
+    steps.step("simplifyInitVar");
     // Change initialisation of variable to assignment
     simplifyInitVar();
 
+    steps.step("simplifyVarDecl2");
     // Split up variable declarations.
     simplifyVarDecl(false);
 
     // typedef..
-    if (m_timerResults) {
-        Timer t("Tokenizer::tokenize::simplifyTypedef", _settings->showtime, m_timerResults);
-        simplifyTypedef();
-    } else {
-        simplifyTypedef();
-    }
+    steps.step("simplifyTypedef");
+    simplifyTypedef();
 
+    steps.step("prepareTernaryOpForAST2");
     // Add parentheses to ternary operator where necessary
     // TODO: this is only necessary if one typedef simplification had a comma and was used within ?:
     // If typedef handling is refactored and moved to symboldatabase someday we can remove this
@@ -3559,17 +3682,21 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyAsm2");
     // Put ^{} statements in asm()
     simplifyAsm2();
 
+    steps.step("simplifyStaticConst");
     // Order keywords "static" and "const"
     simplifyStaticConst();
 
+    steps.step("simplifyPlatformTypes");
     // convert platform dependent types to standard types
     // 32 bits: size_t -> unsigned long
     // 64 bits: size_t -> unsigned long long
     simplifyPlatformTypes();
 
+    steps.step("simplifyStdType");
     // collapse compound standard types into a single token
     // unsigned long long int => long (with _isUnsigned=true,_isLong=true)
     simplifyStdType();
@@ -3577,33 +3704,40 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyBitfields");
     // simplify bit fields..
     simplifyBitfields();
 
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyStructDecl");
     // struct simplification "struct S {} s; => struct S { } ; S s ;
     simplifyStructDecl();
 
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyAssignmentBlock");
     // x = ({ 123; });  =>   { x = 123; }
     simplifyAssignmentBlock();
 
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyVariableMultipleAssign");
     simplifyVariableMultipleAssign();
 
+    steps.step("simplifyOperatorName");
     // Collapse operator name tokens into single token
     // operator = => operator=
     simplifyOperatorName();
 
+    steps.step("simplifyRedundantParentheses");
     // Remove redundant parentheses
     simplifyRedundantParentheses();
 
+    steps.step("simplifyTemplates");
     if (!isC()) {
         // TODO: Only simplify template parameters
         for (Token *tok = list.front(); tok; tok = tok->next())
@@ -3624,30 +3758,32 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
         TemplateSimplifier::cleanupAfterSimplify(list.front());
     }
 
+    steps.step("simplifyPointerToStandardType");
     // Simplify pointer to standard types (C only)
     simplifyPointerToStandardType();
 
+    steps.step("simplifyFunctionPointers");
     // simplify function pointers
     simplifyFunctionPointers();
 
+    steps.step("simplifyInitVar2");
     // Change initialisation of variable to assignment
     simplifyInitVar();
 
+    steps.step("simplifyVarDecl3");
     // Split up variable declarations.
     simplifyVarDecl(false);
 
     validate(); // #6772 "segmentation fault (invalid code) in Tokenizer::setVarId"
 
-    if (m_timerResults) {
-        Timer t("Tokenizer::tokenize::setVarId", _settings->showtime, m_timerResults);
-        setVarId();
-    } else {
-        setVarId();
-    }
+    steps.step("setVarId");
+    setVarId();
 
+    steps.step("createLinks2");
     // Link < with >
     createLinks2();
 
+    steps.step("arraySize");
     // specify array size
     arraySize();
 
@@ -3655,31 +3791,42 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyNamespaceStd");
     // Add std:: in front of std classes, when using namespace std; was given
     simplifyNamespaceStd();
 
+    steps.step("simplifyInitVar3");
     // Change initialisation of variable to assignment
     simplifyInitVar();
 
+    steps.step("simplifyMathFunctions");
     // Convert e.g. atol("0") into 0
     simplifyMathFunctions();
 
+    steps.step("simplifyDoublePlusAndDoubleMinus");
     simplifyDoublePlusAndDoubleMinus();
 
+    steps.step("simplifyArrayAccessSyntax");
     simplifyArrayAccessSyntax();
 
     Token::assignProgressValues(list.front());
 
+    steps.step("removeRedundantSemicolons");
     removeRedundantSemicolons();
 
+    steps.step("simplifyParameterVoid");
     simplifyParameterVoid();
 
+    steps.step("simplifyRedundantConsecutiveBraces");
     simplifyRedundantConsecutiveBraces();
 
+    steps.step("simplifyEmptyNamespaces");
     simplifyEmptyNamespaces();
 
+    steps.step("elseif");
     elseif();
 
+    steps.step("SimplifyNamelessRValueReferences");
     SimplifyNamelessRValueReferences();
 
 
@@ -3689,6 +3836,8 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
 
 bool Tokenizer::simplifyTokenList2()
 {
+    TimerSteps steps("Tokenizer::simplifyTokenList2", _settings->showtime, m_timerResults, &list);
+
     // clear the _functionList so it can't contain dead pointers
     deleteSymbolDatabase();
 
@@ -3698,28 +3847,37 @@ bool Tokenizer::simplifyTokenList2()
         tok->clearValueFlow();
     }
 
+    steps.step("simplifyAssignmentInFunctionCall");
     // f(x=g())   =>   x=g(); f(x)
     simplifyAssignmentInFunctionCall();
 
+    steps.step("simplifyCompoundAssignment");
     // ";a+=b;" => ";a=a+b;"
     simplifyCompoundAssignment();
 
+    steps.step("simplifyCharAt");
     simplifyCharAt();
 
+    steps.step("simplifyReference");
     // simplify references
     simplifyReference();
 
+    steps.step("simplifyStd");
     simplifyStd();
 
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifySizeof");
     simplifySizeof();
 
+    steps.step("simplifyUndefinedSizeArray");
     simplifyUndefinedSizeArray();
 
+    steps.step("simplifyCasts");
     simplifyCasts();
 
+    steps.step("simplifyCalculations");
     // Simplify simple calculations before replace constants, this allows the replacement of constants that are calculated
     // e.g. const static int value = sizeof(X)/sizeof(Y);
     simplifyCalculations();
@@ -3727,28 +3885,40 @@ bool Tokenizer::simplifyTokenList2()
     if (_settings->terminated())
         return false;
 
+    steps.step("simplifyOffsetPointerDereference");
     // Replace "*(ptr + num)" => "ptr[num]"
     simplifyOffsetPointerDereference();
 
+    steps.step("simplifyOffsetPointerReference");
     // Replace "&str[num]" => "(str + num)"
     simplifyOffsetPointerReference();
 
+    steps.step("removeRedundantAssignment");
     removeRedundantAssignment();
 
+    steps.step("simplifyRealloc");
     simplifyRealloc();
 
+    steps.step("simplifyInitVar");
     // Change initialisation of variable to assignment
     simplifyInitVar();
 
+    steps.step("simplifyVarDecl");
     // Simplify variable declarations
     simplifyVarDecl(false);
 
+    steps.step("simplifyErrNoInWhile");
     simplifyErrNoInWhile();
+    steps.step("simplifyIfAndWhileAssign");
     simplifyIfAndWhileAssign();
+    steps.step("simplifyRedundantParentheses");
     simplifyRedundantParentheses();
+    steps.step("simplifyNestedStrcat");
     simplifyNestedStrcat();
+    steps.step("simplifyFuncInWhile");
     simplifyFuncInWhile();
 
+    steps.step("simplifyIfAndWhileAssign2");
     simplifyIfAndWhileAssign();
 
     // replace strlen(str)
@@ -3759,6 +3929,7 @@ bool Tokenizer::simplifyTokenList2()
         }
     }
 
+    steps.step("simplifyKnownVariables");
     bool modified = true;
     while (modified) {
         if (_settings->terminated())
@@ -3777,8 +3948,10 @@ bool Tokenizer::simplifyTokenList2()
         validate();
     }
 
+    steps.step("simplifyWhile0");
     // simplify redundant loops
     simplifyWhile0();
+    steps.step("removeRedundantFor");
     removeRedundantFor();
 
     // Remove redundant parentheses in return..
@@ -3794,35 +3967,48 @@ bool Tokenizer::simplifyTokenList2()
         }
     }
 
+    steps.step("simplifyReturnStrncat");
     simplifyReturnStrncat();
 
+    steps.step("removeRedundantAssignment2");
     removeRedundantAssignment();
 
+    steps.step("simplifyComma");
     simplifyComma();
 
+    steps.step("removeRedundantSemicolons");
     removeRedundantSemicolons();
 
+    steps.step("simplifyFlowControl");
     simplifyFlowControl();
 
+    steps.step("simplifyRedundantConsecutiveBraces");
     simplifyRedundantConsecutiveBraces();
 
+    steps.step("simplifyEmptyNamespaces");
     simplifyEmptyNamespaces();
 
+    steps.step("simplifyMathFunctions");
     simplifyMathFunctions();
 
     validate();
 
     Token::assignProgressValues(list.front());
 
+    steps.step("createAst");
     list.createAst();
     // needed for #7208 (garbage code) and #7724 (ast max depth limit)
     list.validateAst();
 
     // Create symbol database and then remove const keywords
+    steps.step("createSymbolDatabase");
     createSymbolDatabase();
+    steps.step("setValueTypeInTokenList");
     _symbolDatabase->setValueTypeInTokenList();
 
-    ValueFlow::setValues(&list, _symbolDatabase, _errorLogger, _settings);
+    steps.step("ValueFlow");
+    ValueFlow::setValues(&list, _symbolDatabase, _errorLogger, _settings, m_timerResults, m_analyzerInformation);
+    steps.Stop();
 
     if (_settings->terminated())
         return false;
@@ -8550,6 +8736,90 @@ void Tokenizer::simplifyStructDecl()
     }
 }
 
+void Tokenizer::simplifyFused(const std::vector<SimplifyRule> &rules)
+{
+    if (rules.empty())
+        return;
+
+    if (!_settings->debugSimplifyRules) {
+        applyFused(rules);
+        return;
+    }
+
+    // Apply the rules one by one on a copy of the token list so the
+    // result can be compared with the fused traversal
+    Tokenizer sequential(_settings, _errorLogger);
+    for (std::vector<std::string>::const_iterator it = list.getFiles().begin(); it != list.getFiles().end(); ++it)
+        sequential.list.appendFileIfNew(*it);
+    std::map<const Token *, Token *> copies;
+    for (const Token *tok = list.front(); tok; tok = tok->next()) {
+        sequential.list.addtoken(tok, tok->linenr(), tok->fileIndex());
+        copies[tok] = sequential.list.back();
+    }
+    for (const Token *tok = list.front(); tok; tok = tok->next()) {
+        if (tok->link())
+            copies[tok]->link(copies[tok->link()]);
+    }
+    for (std::vector<SimplifyRule>::const_iterator rule = rules.begin(); rule != rules.end(); ++rule)
+        sequential.simplifySequential(*rule);
+
+    applyFused(rules);
+
+    const Token *tok1 = list.front();
+    const Token *tok2 = sequential.list.front();
+    while (tok1 && tok2 && tok1->str() == tok2->str() && tok1->originalName() == tok2->originalName() && tok1->flags() == tok2->flags()) {
+        tok1 = tok1->next();
+        tok2 = tok2->next();
+    }
+    if (tok1 || tok2) {
+        std::string names;
+        for (std::vector<SimplifyRule>::const_iterator rule = rules.begin(); rule != rules.end(); ++rule)
+            names += std::string(names.empty() ? "" : ", ") + rule->name;
+        reportError(tok1 ? tok1 : list.back(), Severity::debug, "debug",
+                    "Fused simplification differs from sequential simplification (" + names + ").");
+    }
+}
+
+void Tokenizer::applyFused(const std::vector<SimplifyRule> &rules)
+{
+    // Most tokens are rejected by their first character, the others are
+    // looked up by their text
+    bool firstChars[256] = { false };
+    std::unordered_map<std::string, std::vector<const SimplifyRule *> > dispatch;
+    for (std::vector<SimplifyRule>::const_iterator rule = rules.begin(); rule != rules.end(); ++rule) {
+        for (std::set<std::string>::const_iterator trigger = rule->triggers.begin(); trigger != rule->triggers.end(); ++trigger) {
+            firstChars[static_cast<unsigned char>((*trigger)[0])] = true;
+            dispatch[*trigger].push_back(&*rule);
+        }
+    }
+
+    for (Token *tok = list.front(); tok; tok = tok->next()) {
+        // a rule might rewrite tok into a token that triggers a rule again
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            if (!firstChars[static_cast<unsigned char>(tok->str()[0])])
+                break;
+            const std::unordered_map<std::string, std::vector<const SimplifyRule *> >::const_iterator it = dispatch.find(tok->str());
+            if (it == dispatch.end())
+                break;
+            for (std::vector<const SimplifyRule *>::const_iterator rule = it->second.begin(); rule != it->second.end(); ++rule) {
+                if ((this->*(*rule)->simplify)(tok)) {
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void Tokenizer::simplifySequential(const SimplifyRule &rule)
+{
+    for (Token *tok = list.front(); tok; tok = tok->next()) {
+        while ((this->*rule.simplify)(tok)) {}
+    }
+}
+
 void Tokenizer::simplifyCallingConvention()
 {
     bool windows = _settings->isWindowsPlatform();
@@ -9157,51 +9427,57 @@ void Tokenizer::simplifyMicrosoftMemoryFunctions()
     if (!_settings->isWindowsPlatform())
         return;
 
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (tok->strAt(1) != "(")
-            continue;
-
-        if (Token::Match(tok, "CopyMemory|RtlCopyMemory|RtlCopyBytes")) {
-            tok->str("memcpy");
-        } else if (Token::Match(tok, "MoveMemory|RtlMoveMemory")) {
-            tok->str("memmove");
-        } else if (Token::Match(tok, "FillMemory|RtlFillMemory|RtlFillBytes")) {
-            // FillMemory(dst, len, val) -> memset(dst, val, len)
-            tok->str("memset");
+    for (Token *tok = list.front(); tok; tok = tok->next())
+        simplifyMicrosoftMemoryFunctions(tok);
+}
 
-            Token *tok1 = tok->tokAt(2);
-            if (tok1)
-                tok1 = tok1->nextArgument(); // Second argument
-            if (tok1) {
-                Token *tok2 = tok1->nextArgument(); // Third argument
+bool Tokenizer::simplifyMicrosoftMemoryFunctions(Token *tok)
+{
+    if (tok->strAt(1) != "(")
+        return false;
 
-                if (tok2)
-                    Token::move(tok1->previous(), tok2->tokAt(-2), tok->next()->link()->previous()); // Swap third with second argument
-            }
-        } else if (Token::Match(tok, "ZeroMemory|RtlZeroMemory|RtlZeroBytes|RtlSecureZeroMemory")) {
-            // ZeroMemory(dst, len) -> memset(dst, 0, len)
-            tok->str("memset");
+    if (Token::Match(tok, "CopyMemory|RtlCopyMemory|RtlCopyBytes")) {
+        tok->str("memcpy");
+    } else if (Token::Match(tok, "MoveMemory|RtlMoveMemory")) {
+        tok->str("memmove");
+    } else if (Token::Match(tok, "FillMemory|RtlFillMemory|RtlFillBytes")) {
+        // FillMemory(dst, len, val) -> memset(dst, val, len)
+        tok->str("memset");
 
-            Token *tok1 = tok->tokAt(2);
-            if (tok1)
-                tok1 = tok1->nextArgument(); // Second argument
+        Token *tok1 = tok->tokAt(2);
+        if (tok1)
+            tok1 = tok1->nextArgument(); // Second argument
+        if (tok1) {
+            Token *tok2 = tok1->nextArgument(); // Third argument
 
-            if (tok1) {
-                tok1 = tok1->previous();
-                tok1->insertToken("0");
-                tok1 = tok1->next();
-                tok1->insertToken(",");
-            }
-        } else if (Token::simpleMatch(tok, "RtlCompareMemory")) {
-            // RtlCompareMemory(src1, src2, len) -> memcmp(src1, src2, len)
-            tok->str("memcmp");
-            // For the record, when memcmp returns 0, both strings are equal.
-            // When RtlCompareMemory returns len, both strings are equal.
-            // It might be needed to improve this replacement by something
-            // like ((len - memcmp(src1, src2, len)) % (len + 1)) to
-            // respect execution path (if required)
+            if (tok2)
+                Token::move(tok1->previous(), tok2->tokAt(-2), tok->next()->link()->previous()); // Swap third with second argument
         }
-    }
+    } else if (Token::Match(tok, "ZeroMemory|RtlZeroMemory|RtlZeroBytes|RtlSecureZeroMemory")) {
+        // ZeroMemory(dst, len) -> memset(dst, 0, len)
+        tok->str("memset");
+
+        Token *tok1 = tok->tokAt(2);
+        if (tok1)
+            tok1 = tok1->nextArgument(); // Second argument
+
+        if (tok1) {
+            tok1 = tok1->previous();
+            tok1->insertToken("0");
+            tok1 = tok1->next();
+            tok1->insertToken(",");
+        }
+    } else if (Token::simpleMatch(tok, "RtlCompareMemory")) {
+        // RtlCompareMemory(src1, src2, len) -> memcmp(src1, src2, len)
+        tok->str("memcmp");
+        // For the record, when memcmp returns 0, both strings are equal.
+        // When RtlCompareMemory returns len, both strings are equal.
+        // It might be needed to improve this replacement by something
+        // like ((len - memcmp(src1, src2, len)) % (len + 1)) to
+        // respect execution path (if required)
+    } else
+        return false;
+    return true;
 }
 
 namespace {
@@ -9245,36 +9521,67 @@ namespace {
             std::make_pair("_stscanf_s", triplet("sscanf_s", "swscanf_s"));
 }
 
+std::vector<Tokenizer::SimplifyRule> Tokenizer::microsoftFunctionRules() const
+{
+    std::vector<SimplifyRule> rules;
+
+    // skip if not Windows
+    if (!_settings->isWindowsPlatform())
+        return rules;
+
+    static const std::set<std::string> memoryFunctions = make_container< std::set<std::string> >() <<
+            "CopyMemory" << "RtlCopyMemory" << "RtlCopyBytes" << "MoveMemory" << "RtlMoveMemory" <<
+            "FillMemory" << "RtlFillMemory" << "RtlFillBytes" <<
+            "ZeroMemory" << "RtlZeroMemory" << "RtlZeroBytes" << "RtlSecureZeroMemory" << "RtlCompareMemory";
+    std::set<std::string> stringFunctions;
+    for (std::map<std::string, triplet>::const_iterator it = apis.begin(); it != apis.end(); ++it)
+        stringFunctions.insert(it->first);
+    stringFunctions.insert("_T");
+
+    // The rules commute: the memory rule only renames its trigger and
+    // moves or inserts whole arguments, and the string rule only reads its
+    // trigger and the '_T ( %str% )' that follow it.
+    rules.push_back(SimplifyRule("simplifyMicrosoftMemoryFunctions", memoryFunctions, &Tokenizer::simplifyMicrosoftMemoryFunctions));
+    rules.push_back(SimplifyRule("simplifyMicrosoftStringFunctions", stringFunctions, &Tokenizer::simplifyMicrosoftStringFunctions));
+    return rules;
+}
+
 void Tokenizer::simplifyMicrosoftStringFunctions()
 {
     // skip if not Windows
     if (!_settings->isWindowsPlatform())
         return;
 
-    const bool ansi = _settings->platformType == Settings::Win32A;
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (tok->strAt(1) != "(")
-            continue;
+    for (Token *tok = list.front(); tok; tok = tok->next())
+        simplifyMicrosoftStringFunctions(tok);
+}
 
-        std::map<std::string, triplet>::const_iterator match = apis.find(tok->str());
-        if (match!=apis.end()) {
-            tok->str(ansi ? match->second.mbcs : match->second.unicode);
-            tok->originalName(match->first);
-        } else if (Token::Match(tok, "_T ( %char%|%str% )")) {
-            tok->deleteNext();
-            tok->deleteThis();
+bool Tokenizer::simplifyMicrosoftStringFunctions(Token *tok)
+{
+    if (tok->strAt(1) != "(")
+        return false;
+
+    const bool ansi = _settings->platformType == Settings::Win32A;
+    std::map<std::string, triplet>::const_iterator match = apis.find(tok->str());
+    if (match!=apis.end()) {
+        tok->str(ansi ? match->second.mbcs : match->second.unicode);
+        tok->originalName(match->first);
+    } else if (Token::Match(tok, "_T ( %char%|%str% )")) {
+        tok->deleteNext();
+        tok->deleteThis();
+        tok->deleteNext();
+        if (!ansi)
+            tok->isLong(true);
+        while (Token::Match(tok->next(), "_T ( %char%|%str% )")) {
+            tok->next()->deleteNext();
+            tok->next()->deleteThis();
+            tok->next()->deleteNext();
+            tok->concatStr(tok->next()->str());
             tok->deleteNext();
-            if (!ansi)
-                tok->isLong(true);
-            while (Token::Match(tok->next(), "_T ( %char%|%str% )")) {
-                tok->next()->deleteNext();
-                tok->next()->deleteThis();
-                tok->next()->deleteNext();
-                tok->concatStr(tok->next()->str());
-                tok->deleteNext();
-            }
         }
-    }
+    } else
+        return false;
+    return true;
 }
 
 // Remove Borland code
@@ -9387,12 +9694,15 @@ void Tokenizer::createSymbolDatabase()
     if (!_symbolDatabase)
         _symbolDatabase = new SymbolDatabase(this, _settings, _errorLogger);
     _symbolDatabase->validate();
+    // the def-use index looks at the functions and variables
+    list.clearDefUse();
 }
 
 void Tokenizer::deleteSymbolDatabase()
 {
     delete _symbolDatabase;
     _symbolDatabase = nullptr;
+    list.clearDefUse();
 }
 
 static bool operatorEnd(const Token * tok)
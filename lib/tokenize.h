@@ -28,8 +28,12 @@
 #include <ctime>
 #include <list>
 #include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+class AnalyzerInformation;
 class Settings;
 class SymbolDatabase;
 class TimerResults;
@@ -58,6 +62,11 @@ public:
         m_timerResults = tr;
     }
 
+    /** ValueFlow uses the return values that other TUs stored in the build dir */
+    void setAnalyzerInformation(AnalyzerInformation *analyzerInformation) {
+        m_analyzerInformation = analyzerInformation;
+    }
+
     /** Is the code C. Used for bailouts */
     bool isC() const {
         return list.isC();
@@ -80,6 +89,18 @@ public:
     void createTokens(const simplecpp::TokenList *tokenList);
 
     bool simplifyTokens1(const std::string &configuration);
+
+    /**
+     * First part of simplifyTokens1(): simplify the token list and create
+     * the AST. The symbol database is not created yet, so the token list
+     * can be compared with the token lists of other configurations first.
+     * @return false if source code contains syntax errors
+     */
+    bool simplifyTokens1Syntax(const std::string &configuration);
+
+    /** Second part of simplifyTokens1(): create the symbol database, set value types and run ValueFlow */
+    void simplifyTokens1Symbols();
+
     /**
      * Tokenize code
      * @param code input stream for code, e.g.
@@ -600,6 +621,43 @@ private:
     /** Detect garbage expression */
     static bool isGarbageExpr(const Token *start, const Token *end);
 
+    /**
+     * A local simplification that only looks at the tokens following
+     * a trigger token. Several rules can be applied in one traversal
+     * of the token list, see simplifyFused().
+     */
+    struct SimplifyRule {
+        SimplifyRule(const char *name_, const std::set<std::string> &triggers_, bool (Tokenizer::*simplify_)(Token *))
+            : name(name_), triggers(triggers_), simplify(simplify_) {}
+
+        /** name, used in debug output */
+        const char *name;
+
+        /** token strings that the rule may rewrite */
+        std::set<std::string> triggers;
+
+        /** simplify at given token, returns true if the token list was changed */
+        bool (Tokenizer::*simplify)(Token *);
+    };
+
+    /**
+     * Apply the given rules in a single traversal of the token list.
+     * The rules must be independent of each other: applying them in
+     * any order gives the same result. With
+     * --debug-simplify-rules the result is compared against applying
+     * the rules one by one.
+     */
+    void simplifyFused(const std::vector<SimplifyRule> &rules);
+
+    /** Apply the given rules in a single traversal of the token list */
+    void applyFused(const std::vector<SimplifyRule> &rules);
+
+    /** Apply a single rule to the whole token list */
+    void simplifySequential(const SimplifyRule &rule);
+
+    /** Rules for simplifyMicrosoftMemoryFunctions() and simplifyMicrosoftStringFunctions() */
+    std::vector<SimplifyRule> microsoftFunctionRules() const;
+
     /**
      * Remove __declspec()
      */
@@ -653,12 +711,14 @@ private:
     * ZeroMemory(dst, len) -> memset(dst, 0, len)
     */
     void simplifyMicrosoftMemoryFunctions();
+    bool simplifyMicrosoftMemoryFunctions(Token *tok);
 
     /**
     * Convert Microsoft string functions
     * _tcscpy -> strcpy
     */
     void simplifyMicrosoftStringFunctions();
+    bool simplifyMicrosoftStringFunctions(Token *tok);
 
     /**
       * Remove Borland code
@@ -708,9 +768,9 @@ private:
     void unsupportedTypedef(const Token *tok) const;
 
     void setVarIdClassDeclaration(const Token * const startToken,
-                                  const std::map<std::string, unsigned int> &variableId,
+                                  const std::unordered_map<std::string, unsigned int> &variableId,
                                   const unsigned int scopeStartVarId,
-                                  std::map<unsigned int, std::map<std::string,unsigned int> >& structMembers);
+                                  std::unordered_map<unsigned int, std::unordered_map<std::string, unsigned int> >& structMembers);
 
 
     /**
@@ -869,6 +929,11 @@ private:
      */
     TimerResults *m_timerResults;
 
+    /**
+     * AnalyzerInformation of the build dir
+     */
+    AnalyzerInformation *m_analyzerInformation;
+
 #ifdef MAXTIME
     /** Tokenizer maxtime */
     std::time_t maxtime;
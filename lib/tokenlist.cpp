@@ -19,6 +19,7 @@
 //---------------------------------------------------------------------------
 #include "tokenlist.h"
 
+#include "astutils.h"
 #include "errorlogger.h"
 #include "mathlib.h"
 #include "path.h"
@@ -26,6 +27,7 @@
 #include "token.h"
 
 #include <simplecpp.h>
+#include <algorithm>
 #include <cctype>
 #include <cstring>
 #include <set>
@@ -38,11 +40,13 @@ static const unsigned int AST_MAX_DEPTH = 50U;
 
 
 TokenList::TokenList(const Settings* settings) :
-    _front(0),
-    _back(0),
     _settings(settings),
     _isC(false),
-    _isCPP(false)
+    _isCPP(false),
+    _indexModifications(0),
+    _indexed(false),
+    _defUseModifications(0),
+    _defUseBuilt(false)
 {
 }
 
@@ -66,9 +70,10 @@ const std::string& TokenList::getSourceFilePath() const
 // Deallocate lists..
 void TokenList::deallocateTokens()
 {
-    deleteTokens(_front);
-    _front = 0;
-    _back = 0;
+    deleteTokens(_tokensFrontBack.front);
+    _tokensFrontBack.front = nullptr;
+    _tokensFrontBack.back = nullptr;
+    ++_tokensFrontBack.modifications;
     _files.clear();
 }
 
@@ -142,18 +147,18 @@ void TokenList::addtoken(std::string str, const unsigned int lineno, const unsig
         str = MathLib::value(str).str() + suffix;
     }
 
-    if (_back) {
-        _back->insertToken(str);
+    if (_tokensFrontBack.back) {
+        _tokensFrontBack.back->insertToken(str);
     } else {
-        _front = new Token(&_back);
-        _back = _front;
-        _back->str(str);
+        _tokensFrontBack.front = new Token(&_tokensFrontBack);
+        _tokensFrontBack.back = _tokensFrontBack.front;
+        _tokensFrontBack.back->str(str);
     }
 
     if (isCPP() && str == "delete")
-        _back->isKeyword(true);
-    _back->linenr(lineno);
-    _back->fileIndex(fileno);
+        _tokensFrontBack.back->isKeyword(true);
+    _tokensFrontBack.back->linenr(lineno);
+    _tokensFrontBack.back->fileIndex(fileno);
 }
 
 void TokenList::addtoken(const Token * tok, const unsigned int lineno, const unsigned int fileno)
@@ -161,19 +166,19 @@ void TokenList::addtoken(const Token * tok, const unsigned int lineno, const uns
     if (tok == nullptr)
         return;
 
-    if (_back) {
-        _back->insertToken(tok->str(), tok->originalName());
+    if (_tokensFrontBack.back) {
+        _tokensFrontBack.back->insertToken(tok->str(), tok->originalName());
     } else {
-        _front = new Token(&_back);
-        _back = _front;
-        _back->str(tok->str());
+        _tokensFrontBack.front = new Token(&_tokensFrontBack);
+        _tokensFrontBack.back = _tokensFrontBack.front;
+        _tokensFrontBack.back->str(tok->str());
         if (!tok->originalName().empty())
-            _back->originalName(tok->originalName());
+            _tokensFrontBack.back->originalName(tok->originalName());
     }
 
-    _back->linenr(lineno);
-    _back->fileIndex(fileno);
-    _back->flags(tok->flags());
+    _tokensFrontBack.back->linenr(lineno);
+    _tokensFrontBack.back->fileIndex(fileno);
+    _tokensFrontBack.back->flags(tok->flags());
 }
 //---------------------------------------------------------------------------
 // InsertTokens - Copy and insert tokens
@@ -263,20 +268,20 @@ void TokenList::createTokens(const simplecpp::TokenList *tokenList)
         if (str.size() > 1 && str[0] == '.' && std::isdigit(str[1]))
             str = '0' + str;
 
-        if (_back) {
-            _back->insertToken(str);
+        if (_tokensFrontBack.back) {
+            _tokensFrontBack.back->insertToken(str);
         } else {
-            _front = new Token(&_back);
-            _back = _front;
-            _back->str(str);
+            _tokensFrontBack.front = new Token(&_tokensFrontBack);
+            _tokensFrontBack.back = _tokensFrontBack.front;
+            _tokensFrontBack.back->str(str);
         }
 
-        if (isCPP() && _back->str() == "delete")
-            _back->isKeyword(true);
-        _back->fileIndex(tok->location.fileIndex);
-        _back->linenr(tok->location.line);
-        _back->col(tok->location.col);
-        _back->isExpandedMacro(!tok->macro.empty());
+        if (isCPP() && _tokensFrontBack.back->str() == "delete")
+            _tokensFrontBack.back->isKeyword(true);
+        _tokensFrontBack.back->fileIndex(tok->location.fileIndex);
+        _tokensFrontBack.back->linenr(tok->location.line);
+        _tokensFrontBack.back->col(tok->location.col);
+        _tokensFrontBack.back->isExpandedMacro(!tok->macro.empty());
     }
 
     if (_settings && _settings->relativePaths) {
@@ -284,7 +289,7 @@ void TokenList::createTokens(const simplecpp::TokenList *tokenList)
             _files[i] = Path::getRelativePath(_files[i], _settings->basePaths);
     }
 
-    Token::assignProgressValues(_front);
+    Token::assignProgressValues(_tokensFrontBack.front);
 }
 
 //---------------------------------------------------------------------------
@@ -1111,7 +1116,8 @@ static Token * createAstAtToken(Token *tok, bool cpp)
 
 void TokenList::createAst()
 {
-    for (Token *tok = _front; tok; tok = tok ? tok->next() : nullptr) {
+    clearDefUse();
+    for (Token *tok = _tokensFrontBack.front; tok; tok = tok ? tok->next() : nullptr) {
         tok = createAstAtToken(tok, isCPP());
     }
 }
@@ -1120,7 +1126,7 @@ void TokenList::validateAst() const
 {
     // Check for some known issues in AST to avoid crash/hang later on
     std::set < const Token* > safeAstTokens; // list of "safe" AST tokens without endless recursion
-    for (const Token *tok = _front; tok; tok = tok->next()) {
+    for (const Token *tok = _tokensFrontBack.front; tok; tok = tok->next()) {
         // Syntax error if binary operator only has 1 operand
         if ((tok->isAssignmentOp() || tok->isComparisonOp() || Token::Match(tok,"[|^/%]")) && tok->astOperand1() && !tok->astOperand2())
             throw InternalError(tok, "Syntax Error: AST broken, binary operator has only one operand.", InternalError::SYNTAX);
@@ -1161,9 +1167,116 @@ bool TokenList::validateToken(const Token* tok) const
 {
     if (!tok)
         return true;
-    for (const Token *t = _front; t; t = t->next()) {
+    for (const Token *t = _tokensFrontBack.front; t; t = t->next()) {
         if (tok==t)
             return true;
     }
     return false;
 }
+
+void TokenList::updateIndex() const
+{
+    if (_indexed && _indexModifications == _tokensFrontBack.modifications)
+        return;
+
+    _strIndex.clear();
+    _typeIndex.assign(Token::eNone + 1, std::vector<const Token *>());
+    for (const Token *tok = _tokensFrontBack.front; tok; tok = tok->next()) {
+        _strIndex[tok->str()].push_back(tok);
+        _typeIndex[tok->tokType()].push_back(tok);
+    }
+
+    _indexModifications = _tokensFrontBack.modifications;
+    _indexed = true;
+}
+
+const std::vector<const Token *> &TokenList::tokensWithStr(const std::string &str) const
+{
+    static const std::vector<const Token *> empty;
+    updateIndex();
+    const std::unordered_map<std::string, std::vector<const Token *> >::const_iterator it = _strIndex.find(str);
+    return (it != _strIndex.end()) ? it->second : empty;
+}
+
+const std::vector<const Token *> &TokenList::tokensWithType(Token::Type type) const
+{
+    updateIndex();
+    return _typeIndex[type];
+}
+
+void TokenList::updateDefUse() const
+{
+    if (_defUseBuilt && _defUseModifications == _tokensFrontBack.modifications)
+        return;
+
+    _defUseTokens.clear();
+    _defUseVars.clear();
+    _defUseChanges.clear();
+    _defUseCalls.clear();
+    unsigned int pos = 0;
+    for (Token *tok = _tokensFrontBack.front; tok; tok = tok->next(), ++pos) {
+        tok->index(pos);
+        _defUseTokens.push_back(tok);
+        if (tok->varId())
+            _defUseVars[tok->varId()].push_back(pos);
+        if (Token::Match(tok, "%name% ("))
+            _defUseCalls.push_back(pos);
+    }
+
+    _defUseModifications = _tokensFrontBack.modifications;
+    _defUseBuilt = true;
+}
+
+bool TokenList::isVariableChanged(const Token *start, const Token *end, unsigned int varid, bool globalvar) const
+{
+    if (varid == 0)
+        return ::isVariableChanged(start, end, varid, globalvar, _settings);
+
+    // Most blocks are short, walking them is cheaper than using the index
+    const Token *tok = start;
+    for (unsigned int count = 0; count < 256U; ++count) {
+        if (tok == end || !tok)
+            return false;
+        if (tok->varId() != varid) {
+            if (globalvar && Token::Match(tok, "%name% ("))
+                // TODO: Is global variable really changed by function call?
+                return true;
+        } else if (isVariableChangedHere(tok, _settings)) {
+            return true;
+        }
+        tok = tok->next();
+    }
+
+    updateDefUse();
+
+    const unsigned int first = tok->index();
+    const unsigned int last = end ? end->index() : ~0U;
+    if (first >= _defUseTokens.size() || _defUseTokens[first] != tok ||
+        (end && (last >= _defUseTokens.size() || _defUseTokens[last] != end)))
+        return ::isVariableChanged(tok, end, varid, globalvar, _settings);
+    if (last <= first)
+        return false;
+
+    std::unordered_map<unsigned int, std::vector<unsigned int> >::iterator changes = _defUseChanges.find(varid);
+    if (changes == _defUseChanges.end()) {
+        changes = _defUseChanges.insert(std::make_pair(varid, std::vector<unsigned int>())).first;
+        const std::vector<unsigned int> &uses = _defUseVars[varid];
+        for (std::size_t i = 0; i < uses.size(); ++i) {
+            if (isVariableChangedHere(_defUseTokens[uses[i]], _settings))
+                changes->second.push_back(uses[i]);
+        }
+    }
+    const std::vector<unsigned int>::const_iterator it = std::lower_bound(changes->second.begin(), changes->second.end(), first);
+    if (it != changes->second.end() && *it < last)
+        return true;
+
+    if (globalvar) {
+        // TODO: Is global variable really changed by function call?
+        std::vector<unsigned int>::const_iterator call = std::lower_bound(_defUseCalls.begin(), _defUseCalls.end(), first);
+        for (; call != _defUseCalls.end() && *call < last; ++call) {
+            if (_defUseTokens[*call]->varId() != varid)
+                return true;
+        }
+    }
+    return false;
+}
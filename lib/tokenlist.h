@@ -22,12 +22,13 @@
 //---------------------------------------------------------------------------
 
 #include "config.h"
+#include "token.h"
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class Settings;
-class Token;
 
 namespace simplecpp {
     class TokenList;
@@ -94,18 +95,23 @@ public:
 
     /** get first token of list */
     const Token *front() const {
-        return _front;
+        return _tokensFrontBack.front;
     }
     Token *front() {
-        return _front;
+        return _tokensFrontBack.front;
     }
 
     /** get last token of list */
     const Token *back() const {
-        return _back;
+        return _tokensFrontBack.back;
     }
     Token *back() {
-        return _back;
+        return _tokensFrontBack.back;
+    }
+
+    /** get number of tokens, kept up to date when tokens are created or deleted */
+    std::size_t tokenCount() const {
+        return _tokensFrontBack.count;
     }
 
     /**
@@ -156,8 +162,55 @@ public:
      */
     bool validateToken(const Token* tok) const;
 
+    /**
+     * Get all tokens with the given text, in token list order. This is
+     * much faster than walking the whole token list when looking for a
+     * handful of names like "memset" or "throw".
+     * The index is built on first use and rebuilt lazily after the token
+     * list has been modified, so it is always in sync with the tokens.
+     * The returned vector is invalidated when the token list is modified.
+     * @param str token text
+     * @return tokens whose str() is equal to str
+     */
+    const std::vector<const Token *> &tokensWithStr(const std::string &str) const;
+
+    /**
+     * Get all tokens of the given type, in token list order.
+     * @see tokensWithStr()
+     * @param type token type
+     * @return tokens whose tokType() is equal to type
+     */
+    const std::vector<const Token *> &tokensWithType(Token::Type type) const;
+
+    /**
+     * Is variable changed in block of code? Same result as the free
+     * function isVariableChanged() but the places where each variable is
+     * changed are looked up in a def-use index instead of walking the
+     * tokens. The index is built on first use and rebuilt lazily after
+     * the token list has been modified.
+     * @param start first token of the block
+     * @param end token after the block, nullptr for the end of the token list
+     * @param varid variable id
+     * @param globalvar is the variable global, function calls are then assumed to change it
+     */
+    bool isVariableChanged(const Token *start, const Token *end, unsigned int varid, bool globalvar) const;
+
+    /**
+     * Drop the def-use index. Needed when the AST or the symbol database
+     * changes, the token modification count does not cover those.
+     */
+    void clearDefUse() {
+        _defUseBuilt = false;
+    }
+
 private:
 
+    /** (Re)build the def-use index if needed */
+    void updateDefUse() const;
+
+    /** (Re)build the token index if the token list was modified since it was built */
+    void updateIndex() const;
+
     /** Disable copy constructor, no implementation */
     TokenList(const TokenList &);
 
@@ -165,7 +218,7 @@ private:
     TokenList &operator=(const TokenList &);
 
     /** Token list */
-    Token *_front, *_back;
+    TokensFrontBack _tokensFrontBack;
 
     /** filenames for the tokenized source code (source + included) */
     std::vector<std::string> _files;
@@ -175,6 +228,36 @@ private:
 
     /** File is known to be C/C++ code */
     bool _isC, _isCPP;
+
+    /** Token index: token text => tokens */
+    mutable std::unordered_map<std::string, std::vector<const Token *> > _strIndex;
+
+    /** Token index: token type => tokens */
+    mutable std::vector<std::vector<const Token *> > _typeIndex;
+
+    /** Modification count of the token list when the index was built */
+    mutable unsigned long long _indexModifications;
+
+    /** Has the index been built? */
+    mutable bool _indexed;
+
+    /** Def-use index: position => token */
+    mutable std::vector<const Token *> _defUseTokens;
+
+    /** Def-use index: varid => positions where the variable is used */
+    mutable std::unordered_map<unsigned int, std::vector<unsigned int> > _defUseVars;
+
+    /** Def-use index: varid => positions where the variable is changed, filled in on first query */
+    mutable std::unordered_map<unsigned int, std::vector<unsigned int> > _defUseChanges;
+
+    /** Def-use index: positions of function calls "%name% (" */
+    mutable std::vector<unsigned int> _defUseCalls;
+
+    /** Modification count of the token list when the def-use index was built */
+    mutable unsigned long long _defUseModifications;
+
+    /** Has the def-use index been built? */
+    mutable bool _defUseBuilt;
 };
 
 /// @}
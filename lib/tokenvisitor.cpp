@@ -0,0 +1,141 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2016 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#include "tokenvisitor.h"
+
+#include "symboldatabase.h"
+#include "timer.h"
+
+#include <iostream>
+//---------------------------------------------------------------------------
+
+TokenVisitor::TokenVisitor(const std::string &name)
+    : _name(name), _tokenTypes(0), _astOperatorTypes(0), _scopes(false), _clocks(0)
+{
+}
+
+void TokenVisitor::subscribeTokens(Token::Type type)
+{
+    _tokenTypes |= 1U << type;
+}
+
+void TokenVisitor::subscribeAstOperators(Token::Type type)
+{
+    _astOperatorTypes |= 1U << type;
+}
+
+void TokenVisitor::subscribeScopes()
+{
+    _scopes = true;
+}
+
+//---------------------------------------------------------------------------
+
+TokenTraversal::TokenTraversal()
+    : _tokenVisitors(Token::eNone + 1), _astOperatorVisitors(Token::eNone + 1)
+{
+}
+
+TokenTraversal::~TokenTraversal()
+{
+    for (std::size_t i = 0; i < _visitors.size(); ++i)
+        delete _visitors[i];
+}
+
+void TokenTraversal::add(TokenVisitor *visitor)
+{
+    _visitors.push_back(visitor);
+    for (unsigned int type = 0; type <= Token::eNone; ++type) {
+        // A visitor that wants all tokens of a type does not also get the operators
+        if (visitor->_tokenTypes & (1U << type))
+            _tokenVisitors[type].push_back(visitor);
+        else if (visitor->_astOperatorTypes & (1U << type))
+            _astOperatorVisitors[type].push_back(visitor);
+    }
+    if (visitor->_scopes)
+        _scopeVisitors.push_back(visitor);
+}
+
+template<bool timed>
+void TokenTraversal::traverse(const Token *front)
+{
+    for (const Token *tok = front; tok; tok = tok->next()) {
+        const Scope *scope = tok->scope();
+        const bool scopeBegin = !_scopeVisitors.empty() && scope && scope->classStart == tok;
+        const bool scopeEnd = !_scopeVisitors.empty() && scope && scope->classEnd == tok;
+
+        if (scopeBegin) {
+            for (std::size_t i = 0; i < _scopeVisitors.size(); ++i) {
+                const std::clock_t start = timed ? std::clock() : 0;
+                _scopeVisitors[i]->scopeBegin(scope);
+                if (timed)
+                    _scopeVisitors[i]->_clocks += std::clock() - start;
+            }
+        }
+
+        const std::vector<TokenVisitor *> &visitors = _tokenVisitors[tok->tokType()];
+        for (std::size_t i = 0; i < visitors.size(); ++i) {
+            const std::clock_t start = timed ? std::clock() : 0;
+            visitors[i]->visitToken(tok);
+            if (timed)
+                visitors[i]->_clocks += std::clock() - start;
+        }
+        if (tok->astOperand1()) {
+            const std::vector<TokenVisitor *> &operatorVisitors = _astOperatorVisitors[tok->tokType()];
+            for (std::size_t i = 0; i < operatorVisitors.size(); ++i) {
+                const std::clock_t start = timed ? std::clock() : 0;
+                operatorVisitors[i]->visitToken(tok);
+                if (timed)
+                    operatorVisitors[i]->_clocks += std::clock() - start;
+            }
+        }
+
+        if (scopeEnd) {
+            for (std::size_t i = 0; i < _scopeVisitors.size(); ++i) {
+                const std::clock_t start = timed ? std::clock() : 0;
+                _scopeVisitors[i]->scopeEnd(scope);
+                if (timed)
+                    _scopeVisitors[i]->_clocks += std::clock() - start;
+            }
+        }
+    }
+}
+
+void TokenTraversal::run(const Token *front, unsigned int showtime, TimerResultsIntf *timerResults)
+{
+    if (_visitors.empty())
+        return;
+
+    if (showtime == SHOWTIME_NONE) {
+        traverse<false>(front);
+        return;
+    }
+
+    Timer timer("TokenTraversal::run", showtime, timerResults);
+    traverse<true>(front);
+    timer.Stop();
+
+    for (std::size_t i = 0; i < _visitors.size(); ++i) {
+        const TokenVisitor *visitor = _visitors[i];
+        if (showtime == SHOWTIME_FILE)
+            std::cout << visitor->name() << ": " << (double)visitor->_clocks / CLOCKS_PER_SEC << "s" << std::endl;
+        else if (timerResults)
+            timerResults->AddResults(visitor->name(), "TokenTraversal::run", visitor->_clocks, 0);
+    }
+}
@@ -0,0 +1,133 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2016 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+//---------------------------------------------------------------------------
+#ifndef tokenvisitorH
+#define tokenvisitorH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+#include "token.h"
+
+#include <ctime>
+#include <string>
+#include <vector>
+
+class Scope;
+class TimerResultsIntf;
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Receives the tokens and scopes it subscribed to from a TokenTraversal
+ *
+ * Checks that only look at one token at a time implement a visitor instead
+ * of their own loop over the token list, so all of them share one traversal.
+ */
+class CPPCHECKLIB TokenVisitor {
+public:
+    /** @param name name that --showtime shows for this visitor */
+    explicit TokenVisitor(const std::string &name);
+    virtual ~TokenVisitor() {
+    }
+
+    const std::string &name() const {
+        return _name;
+    }
+
+    /** Call visitToken() for all tokens of the given type */
+    void subscribeTokens(Token::Type type);
+
+    /** Call visitToken() for the tokens of the given type that have an AST operand */
+    void subscribeAstOperators(Token::Type type);
+
+    /** Call scopeBegin() and scopeEnd() at the braces of all scopes */
+    void subscribeScopes();
+
+    virtual void visitToken(const Token *tok) {
+        (void)tok;
+    }
+
+    /** Called before visitToken() for the '{' of the scope */
+    virtual void scopeBegin(const Scope *scope) {
+        (void)scope;
+    }
+
+    /** Called after visitToken() for the '}' of the scope */
+    virtual void scopeEnd(const Scope *scope) {
+        (void)scope;
+    }
+
+private:
+    friend class TokenTraversal;
+
+    const std::string _name;
+
+    /** subscribed token types, bit n is Token::Type n */
+    unsigned int _tokenTypes;
+    unsigned int _astOperatorTypes;
+    bool _scopes;
+
+    /** time spent in this visitor, only measured for --showtime */
+    std::clock_t _clocks;
+};
+
+/**
+ * @brief Traverses the token list once and dispatches each token to the
+ * visitors that subscribed to it
+ */
+class CPPCHECKLIB TokenTraversal {
+public:
+    TokenTraversal();
+    ~TokenTraversal();
+
+    /** Add a visitor, the traversal takes ownership of it */
+    void add(TokenVisitor *visitor);
+
+    bool empty() const {
+        return _visitors.empty();
+    }
+
+    /**
+     * Visit the tokens from front to the end of the list
+     * @param front first token
+     * @param showtime --showtime mode, the time spent in each visitor is reported
+     * @param timerResults where the times are added
+     */
+    void run(const Token *front, unsigned int showtime = 0, TimerResultsIntf *timerResults = nullptr);
+
+private:
+    template<bool timed>
+    void traverse(const Token *front);
+
+    TokenTraversal(const TokenTraversal &); // disallow copying
+    TokenTraversal &operator=(const TokenTraversal &); // disallow assignments
+
+    std::vector<TokenVisitor *> _visitors;
+
+    /** visitors for each token type */
+    std::vector<std::vector<TokenVisitor *> > _tokenVisitors;
+    std::vector<std::vector<TokenVisitor *> > _astOperatorVisitors;
+    std::vector<TokenVisitor *> _scopeVisitors;
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // tokenvisitorH
@@ -18,6 +18,7 @@
 
 #include "valueflow.h"
 
+#include "analyzerinfo.h"
 #include "astutils.h"
 #include "errorlogger.h"
 #include "library.h"
@@ -26,16 +27,20 @@
 #include "settings.h"
 #include "standards.h"
 #include "symboldatabase.h"
+#include "timer.h"
 #include "token.h"
 #include "tokenlist.h"
 #include "utils.h"
 
 #include <algorithm>
 #include <cstddef>
+#include <deque>
 #include <limits>
+#include <list>
 #include <map>
 #include <set>
 #include <stack>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -310,7 +315,7 @@ static void setTokenValue(Token* tok, const ValueFlow::Value &value, const Setti
                 const Token *op = cond ? tok->astOperand1() : tok->astOperand2();
                 if (!op) // #7769 segmentation fault at setTokenValue()
                     return;
-                const std::list<ValueFlow::Value> &values = op->values();
+                const std::vector<ValueFlow::Value> &values = op->values();
                 if (std::find(values.begin(), values.end(), value) != values.end())
                     setTokenValue(parent, value, settings);
             }
@@ -360,12 +365,12 @@ static void setTokenValue(Token* tok, const ValueFlow::Value &value, const Setti
             return;
         }
 
-        for (std::list<ValueFlow::Value>::const_iterator value1 = parent->astOperand1()->values().begin(); value1 != parent->astOperand1()->values().end(); ++value1) {
+        for (std::vector<ValueFlow::Value>::const_iterator value1 = parent->astOperand1()->values().begin(); value1 != parent->astOperand1()->values().end(); ++value1) {
             if (!value1->isIntValue() && !value1->isFloatValue() && !value1->isTokValue())
                 continue;
             if (value1->isTokValue() && (!parent->isComparisonOp() || value1->tokvalue->tokType() != Token::eString))
                 continue;
-            for (std::list<ValueFlow::Value>::const_iterator value2 = parent->astOperand2()->values().begin(); value2 != parent->astOperand2()->values().end(); ++value2) {
+            for (std::vector<ValueFlow::Value>::const_iterator value2 = parent->astOperand2()->values().begin(); value2 != parent->astOperand2()->values().end(); ++value2) {
                 if (!value2->isIntValue() && !value2->isFloatValue() && !value2->isTokValue())
                     continue;
                 if (value2->isTokValue() && (!parent->isComparisonOp() || value2->tokvalue->tokType() != Token::eString || value1->isTokValue()))
@@ -524,7 +529,7 @@ static void setTokenValue(Token* tok, const ValueFlow::Value &value, const Setti
 
     // !
     else if (parent->str() == "!") {
-        std::list<ValueFlow::Value>::const_iterator it;
+        std::vector<ValueFlow::Value>::const_iterator it;
         for (it = tok->values().begin(); it != tok->values().end(); ++it) {
             if (!it->isIntValue())
                 continue;
@@ -536,7 +541,7 @@ static void setTokenValue(Token* tok, const ValueFlow::Value &value, const Setti
 
     // ~
     else if (parent->str() == "~") {
-        std::list<ValueFlow::Value>::const_iterator it;
+        std::vector<ValueFlow::Value>::const_iterator it;
         for (it = tok->values().begin(); it != tok->values().end(); ++it) {
             if (!it->isIntValue())
                 continue;
@@ -560,7 +565,7 @@ static void setTokenValue(Token* tok, const ValueFlow::Value &value, const Setti
 
     // unary minus
     else if (parent->str() == "-" && !parent->astOperand2()) {
-        std::list<ValueFlow::Value>::const_iterator it;
+        std::vector<ValueFlow::Value>::const_iterator it;
         for (it = tok->values().begin(); it != tok->values().end(); ++it) {
             if (!it->isIntValue() && !it->isFloatValue())
                 continue;
@@ -575,10 +580,10 @@ static void setTokenValue(Token* tok, const ValueFlow::Value &value, const Setti
 
     // Array element
     else if (parent->str() == "[" && parent->astOperand1() && parent->astOperand2()) {
-        for (std::list<ValueFlow::Value>::const_iterator value1 = parent->astOperand1()->values().begin(); value1 != parent->astOperand1()->values().end(); ++value1) {
+        for (std::vector<ValueFlow::Value>::const_iterator value1 = parent->astOperand1()->values().begin(); value1 != parent->astOperand1()->values().end(); ++value1) {
             if (!value1->isTokValue())
                 continue;
-            for (std::list<ValueFlow::Value>::const_iterator value2 = parent->astOperand2()->values().begin(); value2 != parent->astOperand2()->values().end(); ++value2) {
+            for (std::vector<ValueFlow::Value>::const_iterator value2 = parent->astOperand2()->values().begin(); value2 != parent->astOperand2()->values().end(); ++value2) {
                 if (!value2->isIntValue())
                     continue;
                 if (value1->varId == 0U || value2->varId == 0U ||
@@ -769,14 +774,14 @@ static void valueFlowNumber(TokenList *tokenlist)
 
 static void valueFlowString(TokenList *tokenlist)
 {
-    for (Token *tok = tokenlist->front(); tok; tok = tok->next()) {
-        if (tok->tokType() == Token::eString) {
-            ValueFlow::Value strvalue;
-            strvalue.valueType = ValueFlow::Value::TOK;
-            strvalue.tokvalue = tok;
-            strvalue.setKnown();
-            setTokenValue(tok, strvalue, tokenlist->getSettings());
-        }
+    const std::vector<const Token *> &strings = tokenlist->tokensWithType(Token::eString);
+    for (std::size_t i = 0; i < strings.size(); ++i) {
+        Token *tok = const_cast<Token *>(strings[i]);
+        ValueFlow::Value strvalue;
+        strvalue.valueType = ValueFlow::Value::TOK;
+        strvalue.tokvalue = tok;
+        strvalue.setKnown();
+        setTokenValue(tok, strvalue, tokenlist->getSettings());
     }
 }
 
@@ -894,7 +899,7 @@ static void valueFlowBitAnd(TokenList *tokenlist)
 
 static void valueFlowOppositeCondition(SymbolDatabase *symboldatabase, const Settings *settings)
 {
-    for (std::list<Scope>::iterator scope = symboldatabase->scopeList.begin(); scope != symboldatabase->scopeList.end(); ++scope) {
+    for (std::deque<Scope>::iterator scope = symboldatabase->scopeList.begin(); scope != symboldatabase->scopeList.end(); ++scope) {
         if (scope->type != Scope::eIf)
             continue;
         Token *tok = const_cast<Token *>(scope->classDef);
@@ -1063,7 +1068,7 @@ static void valueFlowReverse(TokenList *tokenlist,
 
                 const Token *start = tok2;
                 const Token *end   = start->link();
-                if (isVariableChanged(start,end,varid,var->isGlobal(),settings)) {
+                if (tokenlist->isVariableChanged(start,end,varid,var->isGlobal())) {
                     if (settings->debugwarnings)
                         bailout(tokenlist, errorLogger, tok2, "variable " + var->name() + " is assigned in loop. so valueflow analysis bailout when start of loop is reached.");
                     break;
@@ -1142,7 +1147,7 @@ static void valueFlowBeforeCondition(TokenList *tokenlist, SymbolDatabase *symbo
 
                 // Variable changed in 3rd for-expression
                 if (Token::simpleMatch(tok2->previous(), "for (")) {
-                    if (tok2->astOperand2() && tok2->astOperand2()->astOperand2() && isVariableChanged(tok2->astOperand2()->astOperand2(), tok2->link(), varid, var->isGlobal(), settings)) {
+                    if (tok2->astOperand2() && tok2->astOperand2()->astOperand2() && tokenlist->isVariableChanged(tok2->astOperand2()->astOperand2(), tok2->link(), varid, var->isGlobal())) {
                         varid = 0U;
                         if (settings->debugwarnings)
                             bailout(tokenlist, errorLogger, tok, "variable " + var->name() + " used in loop");
@@ -1154,7 +1159,7 @@ static void valueFlowBeforeCondition(TokenList *tokenlist, SymbolDatabase *symbo
                     const Token * const start = tok2->link()->next();
                     const Token * const end   = start->link();
 
-                    if (isVariableChanged(start,end,varid,var->isGlobal(),settings)) {
+                    if (tokenlist->isVariableChanged(start,end,varid,var->isGlobal())) {
                         varid = 0U;
                         if (settings->debugwarnings)
                             bailout(tokenlist, errorLogger, tok, "variable " + var->name() + " used in loop");
@@ -1230,7 +1235,7 @@ static void valueFlowAST(Token *tok, unsigned int varid, const ValueFlow::Value
             return;
     } else if (tok->str() == "||" && tok->astOperand1()) {
         bool nonzero = false;
-        for (std::list<ValueFlow::Value>::const_iterator it = tok->astOperand1()->values().begin(); it != tok->astOperand1()->values().end(); ++it) {
+        for (std::vector<ValueFlow::Value>::const_iterator it = tok->astOperand1()->values().begin(); it != tok->astOperand1()->values().end(); ++it) {
             nonzero |= (it->intvalue != 0);
         }
         if (!nonzero)
@@ -1249,13 +1254,13 @@ static void handleKnownValuesInLoop(const Token                 *startToken,
                                     std::list<ValueFlow::Value> *values,
                                     unsigned int                varid,
                                     bool                        globalvar,
-                                    const Settings              *settings)
+                                    const TokenList             *tokenlist)
 {
     bool isChanged = false;
     for (std::list<ValueFlow::Value>::iterator it = values->begin(); it != values->end(); ++it) {
         if (it->isKnown()) {
             if (!isChanged) {
-                if (!isVariableChanged(startToken, endToken, varid, globalvar, settings))
+                if (!tokenlist->isVariableChanged(startToken, endToken, varid, globalvar))
                     break;
                 isChanged = true;
             }
@@ -1321,7 +1326,7 @@ static bool valueFlowForward(Token * const               startToken,
             } else if (indentlevel <= 0 &&
                        Token::simpleMatch(tok2->link()->previous(), "else {") &&
                        !isReturnScope(tok2->link()->tokAt(-2)) &&
-                       isVariableChanged(tok2->link(), tok2, varid, var->isGlobal(), settings)) {
+                       tokenlist->isVariableChanged(tok2->link(), tok2, varid, var->isGlobal())) {
                 std::list<ValueFlow::Value>::iterator it;
                 for (it = values.begin(); it != values.end(); ++it)
                     it->changeKnownToPossible();
@@ -1367,19 +1372,19 @@ static bool valueFlowForward(Token * const               startToken,
             if (Token::simpleMatch(end, "} while ("))
                 end = end->linkAt(2);
 
-            if (isVariableChanged(start, end, varid, var->isGlobal(), settings)) {
+            if (tokenlist->isVariableChanged(start, end, varid, var->isGlobal())) {
                 if (settings->debugwarnings)
                     bailout(tokenlist, errorLogger, tok2, "variable " + var->name() + " valueFlowForward, assignment in do-while");
                 return false;
             }
 
-            handleKnownValuesInLoop(start, end, &values, varid, var->isGlobal(), settings);
+            handleKnownValuesInLoop(start, end, &values, varid, var->isGlobal(), tokenlist);
         }
 
         // conditional block of code that assigns variable..
         else if (!tok2->varId() && Token::Match(tok2, "%name% (") && Token::simpleMatch(tok2->linkAt(1), ") {")) {
             // is variable changed in condition?
-            if (isVariableChanged(tok2->next(), tok2->next()->link(), varid, var->isGlobal(), settings)) {
+            if (tokenlist->isVariableChanged(tok2->next(), tok2->next()->link(), varid, var->isGlobal())) {
                 if (settings->debugwarnings)
                     bailout(tokenlist, errorLogger, tok2, "variable " + var->name() + " valueFlowForward, assignment in condition");
                 return false;
@@ -1387,7 +1392,7 @@ static bool valueFlowForward(Token * const               startToken,
 
             // if known variable is changed in loop body, change it to a possible value..
             if (Token::Match(tok2, "for|while"))
-                handleKnownValuesInLoop(tok2, tok2->linkAt(1)->linkAt(1), &values, varid, var->isGlobal(), settings);
+                handleKnownValuesInLoop(tok2, tok2->linkAt(1)->linkAt(1), &values, varid, var->isGlobal(), tokenlist);
 
             // Set values in condition
             for (Token* tok3 = tok2->tokAt(2); tok3 != tok2->next()->link(); tok3 = tok3->next()) {
@@ -1427,7 +1432,7 @@ static bool valueFlowForward(Token * const               startToken,
                                  errorLogger,
                                  settings);
 
-                if (isVariableChanged(startToken1, startToken1->link(), varid, var->isGlobal(), settings)) {
+                if (tokenlist->isVariableChanged(startToken1, startToken1->link(), varid, var->isGlobal())) {
                     removeValues(values, truevalues);
 
                     std::list<ValueFlow::Value>::iterator it;
@@ -1450,7 +1455,7 @@ static bool valueFlowForward(Token * const               startToken,
             Token * const start = tok2->linkAt(1)->next();
             Token * const end   = start->link();
             bool varusage = (indentlevel >= 0 && constValue && number_of_if == 0U) ?
-                            isVariableChanged(start,end,varid,var->isGlobal(),settings) :
+                            tokenlist->isVariableChanged(start,end,varid,var->isGlobal()) :
                             (nullptr != Token::findmatch(start, "%varid%", end, varid));
             if (!read) {
                 read = bool(nullptr != Token::findmatch(tok2, "%varid% !!=", end, varid));
@@ -1519,7 +1524,7 @@ static bool valueFlowForward(Token * const               startToken,
                 return false;
             }
 
-            if (isVariableChanged(start, end, varid, var->isGlobal(), settings)) {
+            if (tokenlist->isVariableChanged(start, end, varid, var->isGlobal())) {
                 if ((!read || number_of_if == 0) &&
                     Token::simpleMatch(tok2, "if (") &&
                     !(Token::simpleMatch(end, "} else {") &&
@@ -1805,7 +1810,7 @@ static bool valueFlowForward(Token * const               startToken,
             Token::simpleMatch(tok2->linkAt(1), "] (") &&
             Token::simpleMatch(tok2->linkAt(1)->linkAt(1), ") {")) {
             const Token *bodyStart = tok2->linkAt(1)->linkAt(1)->next();
-            if (isVariableChanged(bodyStart, bodyStart->link(), varid, var->isGlobal(), settings)) {
+            if (tokenlist->isVariableChanged(bodyStart, bodyStart->link(), varid, var->isGlobal())) {
                 if (settings->debugwarnings)
                     bailout(tokenlist, errorLogger, tok2, "valueFlowForward, " + var->name() + " is changed in lambda function");
                 return false;
@@ -1990,11 +1995,9 @@ static void valueFlowAfterAssign(TokenList *tokenlist, SymbolDatabase* symboldat
             if (!tok->astOperand2() || tok->astOperand2()->values().empty())
                 continue;
 
-            std::list<ValueFlow::Value> values = tok->astOperand2()->values();
-            for (std::list<ValueFlow::Value>::iterator it = values.begin(); it != values.end(); ++it) {
-                const std::string info = "Assignment '" + tok->expressionString() + "', assigned value is " + it->infoString();
-                it->errorPath.push_back(ErrorPathItem(tok->astOperand2(), info));
-            }
+            std::list<ValueFlow::Value> values(tok->astOperand2()->values().begin(), tok->astOperand2()->values().end());
+            for (std::list<ValueFlow::Value>::iterator it = values.begin(); it != values.end(); ++it)
+                it->errorPath.push_back(ValueFlow::Value::ErrorPathItem(ValueFlow::Value::ErrorPathItem::ASSIGNMENT, tok->astOperand2(), tok, *it));
             const bool constValue = tok->astOperand2()->isNumber();
 
             if (tokenlist->isCPP() && Token::Match(var->typeStartToken(), "bool|_Bool")) {
@@ -2108,7 +2111,7 @@ static void valueFlowAfterCondition(TokenList *tokenlist, SymbolDatabase* symbol
                 // does condition reassign variable?
                 if (tok != top->astOperand2() &&
                     Token::Match(top->astOperand2(), "%oror%|&&") &&
-                    isVariableChanged(top, top->link(), varid, var->isGlobal(), settings)) {
+                    tokenlist->isVariableChanged(top, top->link(), varid, var->isGlobal())) {
                     if (settings->debugwarnings)
                         bailout(tokenlist, errorLogger, tok, "assignment in condition");
                     continue;
@@ -2151,7 +2154,7 @@ static void valueFlowAfterCondition(TokenList *tokenlist, SymbolDatabase* symbol
                     if (!valueFlowForward(startToken->next(), startToken->link(), var, varid, values, true, false, tokenlist, errorLogger, settings))
                         continue;
                     values.front().setPossible();
-                    if (isVariableChanged(startToken, startToken->link(), varid, var->isGlobal(), settings)) {
+                    if (tokenlist->isVariableChanged(startToken, startToken->link(), varid, var->isGlobal())) {
                         // TODO: The endToken should not be startToken->link() in the valueFlowForward call
                         if (settings->debugwarnings)
                             bailout(tokenlist, errorLogger, startToken->link(), "valueFlowAfterCondition: " + var->name() + " is changed in conditional block");
@@ -2455,7 +2458,7 @@ static void valueFlowForLoopSimplify(Token * const bodyStart, const unsigned int
     const Token * const bodyEnd = bodyStart->link();
 
     // Is variable modified inside for loop
-    if (isVariableChanged(bodyStart, bodyEnd, varid, globalvar, settings))
+    if (tokenlist->isVariableChanged(bodyStart, bodyEnd, varid, globalvar))
         return;
 
     for (Token *tok2 = bodyStart->next(); tok2 != bodyEnd; tok2 = tok2->next()) {
@@ -2556,7 +2559,7 @@ static void valueFlowForLoopSimplifyAfter(Token *fortok, unsigned int varid, con
 
     std::list<ValueFlow::Value> values;
     values.push_back(ValueFlow::Value(num));
-    values.back().errorPath.push_back(ErrorPathItem(fortok,"After for loop, " + var->name() + " has value " + values.back().infoString()));
+    values.back().errorPath.push_back(ValueFlow::Value::ErrorPathItem(ValueFlow::Value::ErrorPathItem::AFTER_LOOP, fortok, var->nameToken(), values.back()));
 
     valueFlowForward(fortok->linkAt(1)->linkAt(1)->next(),
                      endToken,
@@ -2572,7 +2575,7 @@ static void valueFlowForLoopSimplifyAfter(Token *fortok, unsigned int varid, con
 
 static void valueFlowForLoop(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings)
 {
-    for (std::list<Scope>::const_iterator scope = symboldatabase->scopeList.begin(); scope != symboldatabase->scopeList.end(); ++scope) {
+    for (std::deque<Scope>::const_iterator scope = symboldatabase->scopeList.begin(); scope != symboldatabase->scopeList.end(); ++scope) {
         if (scope->type != Scope::eFor)
             continue;
 
@@ -2617,6 +2620,46 @@ static void valueFlowForLoop(TokenList *tokenlist, SymbolDatabase* symboldatabas
     }
 }
 
+namespace {
+    /**
+     * What the interprocedural analysis already found out about the
+     * functions of one configuration. Calls with the same argument values
+     * reuse it instead of analysing the function again.
+     */
+    struct FunctionSummaries {
+        FunctionSummaries() : injectHits(0), returnHits(0) {}
+
+        /** integer argument values that were already passed into the function body, by their intvalues */
+        std::map<const Variable *, std::map<std::vector<MathLib::bigint>, std::list<std::list<ValueFlow::Value> > > > injected;
+
+        /** return value for the given argument values, first is false if it could not be determined */
+        std::map<std::pair<const Function *, std::vector<MathLib::bigint> >, std::pair<bool, MathLib::bigint> > returnValues;
+
+        unsigned long injectHits;
+        unsigned long returnHits;
+
+        /**
+         * Have these values been passed into the function body already? Remember them otherwise.
+         * Token values point at a different token for each call so they are not remembered.
+         */
+        bool isInjected(const Variable *arg, const std::list<ValueFlow::Value> &argvalues) {
+            std::vector<MathLib::bigint> intvalues;
+            for (std::list<ValueFlow::Value>::const_iterator it = argvalues.begin(); it != argvalues.end(); ++it) {
+                if (!it->isIntValue())
+                    return false;
+                intvalues.push_back(it->intvalue);
+            }
+            std::list<std::list<ValueFlow::Value> > &values = injected[arg][intvalues];
+            if (std::find(values.begin(), values.end(), argvalues) != values.end()) {
+                ++injectHits;
+                return true;
+            }
+            values.push_back(argvalues);
+            return false;
+        }
+    };
+}
+
 static void valueFlowInjectParameter(TokenList* tokenlist, ErrorLogger* errorLogger, const Settings* settings, const Variable* arg, const Scope* functionScope, const std::list<ValueFlow::Value>& argvalues)
 {
     // Is argument passed by value or const reference, and is it a known non-class type?
@@ -2633,7 +2676,7 @@ static void valueFlowInjectParameter(TokenList* tokenlist, ErrorLogger* errorLog
 
 static void valueFlowSwitchVariable(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings)
 {
-    for (std::list<Scope>::iterator scope = symboldatabase->scopeList.begin(); scope != symboldatabase->scopeList.end(); ++scope) {
+    for (std::deque<Scope>::iterator scope = symboldatabase->scopeList.begin(); scope != symboldatabase->scopeList.end(); ++scope) {
         if (scope->type != Scope::ScopeType::eSwitch)
             continue;
         if (!Token::Match(scope->classDef, "switch ( %var% ) {"))
@@ -2682,9 +2725,9 @@ static void valueFlowSwitchVariable(TokenList *tokenlist, SymbolDatabase* symbol
     }
 }
 
-static void setTokenValues(Token *tok, const std::list<ValueFlow::Value> &values, const Settings *settings)
+static void setTokenValues(Token *tok, const std::vector<ValueFlow::Value> &values, const Settings *settings)
 {
-    for (std::list<ValueFlow::Value>::const_iterator it = values.begin(); it != values.end(); ++it) {
+    for (std::vector<ValueFlow::Value>::const_iterator it = values.begin(); it != values.end(); ++it) {
         const ValueFlow::Value &value = *it;
         if (value.isIntValue())
             setTokenValue(tok, value, settings);
@@ -2705,7 +2748,7 @@ static void valueFlowLibraryFunction(Token *tok, const std::string &returnValue,
         return;
 
     if (Token::simpleMatch(tokenList.front(), "strlen ( arg1 )") && arg1) {
-        for (std::list<ValueFlow::Value>::const_iterator it = arg1->values().begin(); it != arg1->values().end(); ++it) {
+        for (std::vector<ValueFlow::Value>::const_iterator it = arg1->values().begin(); it != arg1->values().end(); ++it) {
             const ValueFlow::Value &value = *it;
             if (value.isTokValue() && value.tokvalue->tokType() == Token::eString) {
                 ValueFlow::Value retval(value); // copy all "inconclusive", "condition", etc attributes
@@ -2745,9 +2788,28 @@ static void valueFlowLibraryFunction(Token *tok, const std::string &returnValue,
     }
 }
 
-static void valueFlowSubFunction(TokenList *tokenlist, ErrorLogger *errorLogger, const Settings *settings)
+static std::size_t countValues(const Scope *scope)
 {
-    for (Token *tok = tokenlist->front(); tok; tok = tok->next()) {
+    std::size_t count = 0;
+    for (const Token *tok = scope->classStart; tok != scope->classEnd; tok = tok->next())
+        count += tok->values().size();
+    return count;
+}
+
+/**
+ * Pass argument values to the called functions.
+ * @param start first token to look for function calls
+ * @param end end token, or nullptr for the end of the token list
+ * @param changedScopes function scopes that got new values are appended to this
+ * @param summaries argument values that were passed before are not passed again
+ */
+static void valueFlowSubFunction(TokenList *tokenlist, Token *start, const Token *end, ErrorLogger *errorLogger, const Settings *settings, std::vector<const Scope *> *changedScopes, FunctionSummaries *summaries)
+{
+    // number of values in the called function scopes before values were passed to them
+    std::map<const Scope *, std::size_t> valueCount;
+    std::vector<const Scope *> calledScopes;
+
+    for (Token *tok = start; tok != end; tok = tok->next()) {
         if (!Token::Match(tok, "%name% ("))
             continue;
 
@@ -2778,35 +2840,38 @@ static void valueFlowSubFunction(TokenList *tokenlist, ErrorLogger *errorLogger,
                 argvalues.push_back(ValueFlow::Value(0));
                 argvalues.push_back(ValueFlow::Value(1));
             } else {
-                argvalues = argtok->values();
+                argvalues.assign(argtok->values().begin(), argtok->values().end());
             }
 
             if (argvalues.empty())
                 continue;
 
             // Error path..
-            for (std::list<ValueFlow::Value>::iterator it = argvalues.begin(); it != argvalues.end(); ++it) {
-                std::string nr = MathLib::toString(argnr + 1) + getOrdinalText(argnr + 1);
-
-                it->errorPath.push_back(ErrorPathItem(argtok,
-                                                      "Calling function '" +
-                                                      calledFunction->name() +
-                                                      "', " +
-                                                      nr +
-                                                      " argument '" +
-                                                      argvar->name() +
-                                                      "' value is " +
-                                                      it->infoString()));
-            }
+            for (std::list<ValueFlow::Value>::iterator it = argvalues.begin(); it != argvalues.end(); ++it)
+                it->errorPath.push_back(ValueFlow::Value::ErrorPathItem(argtok, calledFunction->tokenDef, argnr, argvar->nameToken(), *it));
 
             // passed values are not "known"..
             for (std::list<ValueFlow::Value>::iterator it = argvalues.begin(); it != argvalues.end(); ++it) {
                 it->changeKnownToPossible();
             }
 
+            // The same values would not add anything new
+            if (summaries->isInjected(argvar, argvalues))
+                continue;
+
+            if (valueCount.find(calledFunctionScope) == valueCount.end()) {
+                valueCount[calledFunctionScope] = countValues(calledFunctionScope);
+                calledScopes.push_back(calledFunctionScope);
+            }
+
             valueFlowInjectParameter(tokenlist, errorLogger, settings, argvar, calledFunctionScope, argvalues);
         }
     }
+
+    for (std::vector<const Scope *>::const_iterator it = calledScopes.begin(); it != calledScopes.end(); ++it) {
+        if (countValues(*it) != valueCount[*it])
+            changedScopes->push_back(*it);
+    }
 }
 
 static void valueFlowFunctionDefaultParameter(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings)
@@ -2823,9 +2888,9 @@ static void valueFlowFunctionDefaultParameter(TokenList *tokenlist, SymbolDataba
         for (std::size_t arg = function->minArgCount(); arg < function->argCount(); arg++) {
             const Variable* var = function->getArgumentVar(arg);
             if (var && var->hasDefault() && Token::Match(var->nameToken(), "%var% = %num%|%str% [,)]")) {
-                const std::list<ValueFlow::Value> &values = var->nameToken()->tokAt(2)->values();
+                const std::vector<ValueFlow::Value> &values = var->nameToken()->tokAt(2)->values();
                 std::list<ValueFlow::Value> argvalues;
-                for (std::list<ValueFlow::Value>::const_iterator it = values.begin(); it != values.end(); ++it) {
+                for (std::vector<ValueFlow::Value>::const_iterator it = values.begin(); it != values.end(); ++it) {
                     ValueFlow::Value v(*it);
                     v.defaultArg = true;
                     v.changeKnownToPossible();
@@ -2844,12 +2909,57 @@ static bool isKnown(const Token * tok)
     return tok && tok->hasKnownIntValue();
 }
 
-static void valueFlowFunctionReturn(TokenList *tokenlist, ErrorLogger *errorLogger)
+/**
+ * Key of a global function in the return values of the build dir, empty if
+ * it has none. The parameter types are in the key so that overloads in
+ * other TUs are told apart.
+ */
+static std::string returnValueKey(const Function *function)
+{
+    if (!function->nestedIn || function->nestedIn->type != Scope::eGlobal || function->isStaticLocal() || function->isStatic())
+        return emptyString;
+    std::string key = function->name() + '(';
+    for (std::size_t i = 0; i < function->argCount(); ++i) {
+        const Variable * const arg = function->getArgumentVar(i);
+        if (!arg || !arg->typeStartToken() || !arg->typeEndToken())
+            return emptyString;
+        // Qualifiers such as 'const' are before the type start token
+        const Token *start = arg->typeStartToken();
+        while (start->previous() && !Token::Match(start->previous(), "(|,"))
+            start = start->previous();
+        if (i > 0)
+            key += ',';
+        for (const Token *tok = start; tok; tok = tok->next()) {
+            if (tok != start)
+                key += ' ';
+            key += tok->str();
+            if (tok == arg->typeEndToken())
+                break;
+        }
+    }
+    return key + ')';
+}
+
+static void valueFlowFunctionReturn(TokenList *tokenlist, ErrorLogger *errorLogger, FunctionSummaries *summaries, AnalyzerInformation *analyzerInformation)
 {
+    const std::string &buildDir = tokenlist->getSettings()->buildDir;
+
     for (Token *tok = tokenlist->back(); tok; tok = tok->previous()) {
         if (tok->str() != "(" || !tok->astOperand1() || !tok->astOperand1()->function())
             continue;
 
+        // Function body is in another TU..
+        if (!buildDir.empty() && analyzerInformation && !tok->astOperand1()->function()->hasBody()) {
+            const std::string key = returnValueKey(tok->astOperand1()->function());
+            MathLib::bigint result = 0;
+            if (!key.empty() && analyzerInformation->getReturnValue(buildDir, key, &result)) {
+                ValueFlow::Value v(result);
+                v.setKnown();
+                setTokenValue(tok, v, tokenlist->getSettings());
+            }
+            continue;
+        }
+
         // Arguments..
         std::vector<MathLib::bigint> parvalues;
         if (tok->astOperand2()) {
@@ -2892,13 +3002,21 @@ static void valueFlowFunctionReturn(TokenList *tokenlist, ErrorLogger *errorLogg
             continue;
 
         // Determine return value of subfunction..
-        MathLib::bigint result = 0;
-        bool error = false;
-        execute(functionScope->classStart->next()->astOperand1(),
-                &programMemory,
-                &result,
-                &error);
-        if (!error) {
+        const std::pair<const Function *, std::vector<MathLib::bigint> > key(function, parvalues);
+        std::map<std::pair<const Function *, std::vector<MathLib::bigint> >, std::pair<bool, MathLib::bigint> >::const_iterator summary = summaries->returnValues.find(key);
+        if (summary != summaries->returnValues.end()) {
+            ++summaries->returnHits;
+        } else {
+            MathLib::bigint result = 0;
+            bool error = false;
+            execute(functionScope->classStart->next()->astOperand1(),
+                    &programMemory,
+                    &result,
+                    &error);
+            summary = summaries->returnValues.insert(std::make_pair(key, std::make_pair(!error, result))).first;
+        }
+        if (summary->second.first) {
+            const MathLib::bigint result = summary->second.second;
             ValueFlow::Value v(result);
             if (function->isVirtual())
                 v.setPossible();
@@ -2964,7 +3082,73 @@ ValueFlow::Value::Value(const Token *c, long long val)
       defaultArg(false),
       valueKind(ValueKind::Possible)
 {
-    errorPath.push_back(ErrorPathItem(c, "Assuming that condition '" + c->expressionString() + "' is not redundant"));
+    errorPath.push_back(ErrorPathItem(c));
+}
+
+ValueFlow::Value::ErrorPathItem::ErrorPathItem(Kind _kind, const Token *_tok, const Token *_context, const Value &value)
+    : tok(_tok),
+      kind(_kind),
+      context(_context),
+      argument(nullptr),
+      argnr(0),
+      valueType(value.valueType),
+      intvalue(value.intvalue),
+      tokvalue(value.tokvalue),
+      floatValue(value.floatValue)
+{
+}
+
+ValueFlow::Value::ErrorPathItem::ErrorPathItem(const Token *_tok, const Token *function, unsigned int _argnr, const Token *_argument, const Value &value)
+    : tok(_tok),
+      kind(FUNCTION_ARGUMENT),
+      context(function),
+      argument(_argument),
+      argnr(_argnr),
+      valueType(value.valueType),
+      intvalue(value.intvalue),
+      tokvalue(value.tokvalue),
+      floatValue(value.floatValue)
+{
+}
+
+ValueFlow::Value::ErrorPathItem::ErrorPathItem(const Token *condition)
+    : tok(condition),
+      kind(CONDITION),
+      context(nullptr),
+      argument(nullptr),
+      argnr(0),
+      valueType(INT),
+      intvalue(0),
+      tokvalue(nullptr),
+      floatValue(0.0)
+{
+}
+
+std::string ValueFlow::Value::ErrorPathItem::str() const
+{
+    switch (kind) {
+    case ASSIGNMENT:
+        return "Assignment '" + context->expressionString() + "', assigned value is " + valueString();
+    case AFTER_LOOP:
+        return "After for loop, " + (context ? context->str() : emptyString) + " has value " + valueString();
+    case FUNCTION_ARGUMENT:
+        return "Calling function '" + context->str() + "', " +
+               MathLib::toString(argnr + 1) + getOrdinalText(argnr + 1) +
+               " argument '" + (argument ? argument->str() : emptyString) + "' value is " + valueString();
+    case CONDITION:
+        return "Assuming that condition '" + tok->expressionString() + "' is not redundant";
+    };
+    throw InternalError(nullptr, "Invalid ValueFlow error path kind");
+}
+
+std::string ValueFlow::Value::ErrorPathItem::valueString() const
+{
+    Value value;
+    value.valueType = valueType;
+    value.intvalue = intvalue;
+    value.tokvalue = tokvalue;
+    value.floatValue = floatValue;
+    return value.infoString();
 }
 
 std::string ValueFlow::Value::infoString() const
@@ -2995,30 +3179,98 @@ const ValueFlow::Value *ValueFlow::valueFlowConstantFoldAST(const Token *expr, c
 }
 
 
-void ValueFlow::setValues(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings)
+void ValueFlow::setValues(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings, TimerResultsIntf *timerResults, AnalyzerInformation *analyzerInformation)
 {
+    TimerSteps steps("ValueFlow::setValues", settings->showtime, timerResults);
+
+    steps.step("clearValueFlow");
     for (Token *tok = tokenlist->front(); tok; tok = tok->next())
         tok->clearValueFlow();
 
+    steps.step("valueFlowNumber");
     valueFlowNumber(tokenlist);
+    steps.step("valueFlowString");
     valueFlowString(tokenlist);
+    steps.step("valueFlowArray");
     valueFlowArray(tokenlist);
+    steps.step("valueFlowPointerAlias");
     valueFlowPointerAlias(tokenlist);
-    valueFlowFunctionReturn(tokenlist, errorLogger);
+    FunctionSummaries summaries;
+    steps.step("valueFlowFunctionReturn");
+    valueFlowFunctionReturn(tokenlist, errorLogger, &summaries, analyzerInformation);
+    steps.step("valueFlowBitAnd");
     valueFlowBitAnd(tokenlist);
+    steps.step("valueFlowOppositeCondition");
     valueFlowOppositeCondition(symboldatabase, settings);
+    steps.step("valueFlowBeforeCondition");
     valueFlowBeforeCondition(tokenlist, symboldatabase, errorLogger, settings);
+    steps.step("valueFlowAfterMove");
     valueFlowAfterMove(tokenlist, symboldatabase, errorLogger, settings);
+    steps.step("valueFlowAfterAssign");
     valueFlowAfterAssign(tokenlist, symboldatabase, errorLogger, settings);
+    steps.step("valueFlowAfterCondition");
     valueFlowAfterCondition(tokenlist, symboldatabase, errorLogger, settings);
+    steps.step("valueFlowSwitchVariable");
     valueFlowSwitchVariable(tokenlist, symboldatabase, errorLogger, settings);
+    steps.step("valueFlowForLoop");
     valueFlowForLoop(tokenlist, symboldatabase, errorLogger, settings);
-    valueFlowSubFunction(tokenlist, errorLogger, settings);
+    steps.step("valueFlowSubFunction");
+    std::vector<const Scope *> changedScopes;
+    valueFlowSubFunction(tokenlist, tokenlist->front(), nullptr, errorLogger, settings, &changedScopes, &summaries);
+    // Values that were passed to a function can be passed on to the functions it calls.
+    // Only the function calls in the functions that got new values are visited again.
+    for (unsigned int round = 1; round < 4 && !changedScopes.empty(); ++round) {
+        steps.step("valueFlowSubFunction (worklist)");
+        std::vector<const Scope *> worklist;
+        worklist.swap(changedScopes);
+        std::set<const Scope *> visited;
+        for (std::vector<const Scope *>::const_iterator it = worklist.begin(); it != worklist.end(); ++it) {
+            if (visited.insert(*it).second)
+                valueFlowSubFunction(tokenlist, const_cast<Token *>((*it)->classStart), (*it)->classEnd, errorLogger, settings, &changedScopes, &summaries);
+        }
+    }
+    steps.step("valueFlowFunctionDefaultParameter");
     valueFlowFunctionDefaultParameter(tokenlist, symboldatabase, errorLogger, settings);
+    steps.step("valueFlowUninit");
     valueFlowUninit(tokenlist, symboldatabase, errorLogger, settings);
+    steps.Stop();
+
+    if (timerResults && settings->showtime != SHOWTIME_NONE) {
+        timerResults->AddCount("ValueFlow::setValues::valueFlowFunctionReturn (summary hits)", "ValueFlow::setValues", summaries.returnHits);
+        timerResults->AddCount("ValueFlow::setValues::valueFlowSubFunction (summary hits)", "ValueFlow::setValues", summaries.injectHits);
+    }
 }
 
 
+void ValueFlow::getReturnValues(const SymbolDatabase *symboldatabase, std::map<std::string, long long> *returnValues)
+{
+    // Functions that are defined twice with the same key are left out
+    std::map<std::string, unsigned int> keyCount;
+    const std::size_t functions = symboldatabase->functionScopes.size();
+    for (std::size_t i = 0; i < functions; ++i) {
+        const Scope * const scope = symboldatabase->functionScopes[i];
+        if (scope->function)
+            ++keyCount[returnValueKey(scope->function)];
+    }
+
+    for (std::size_t i = 0; i < functions; ++i) {
+        const Scope * const scope = symboldatabase->functionScopes[i];
+        if (!scope->function || !Token::simpleMatch(scope->classStart, "{ return"))
+            continue;
+        const std::string key = returnValueKey(scope->function);
+        if (key.empty() || keyCount[key] > 1U)
+            continue;
+
+        // The value must not depend on the arguments
+        ProgramMemory programMemory;
+        MathLib::bigint result = 0;
+        bool error = false;
+        execute(scope->classStart->next()->astOperand1(), &programMemory, &result, &error);
+        if (!error)
+            (*returnValues)[key] = result;
+    }
+}
+
 std::string ValueFlow::eitherTheConditionIsRedundant(const Token *condition)
 {
     if (!condition)
@@ -24,21 +24,21 @@
 #include "config.h"
 
 #include <list>
+#include <map>
 #include <string>
 #include <utility>
 
+class AnalyzerInformation;
 class ErrorLogger;
 class Settings;
 class SymbolDatabase;
+class TimerResultsIntf;
 class Token;
 class TokenList;
 
 namespace ValueFlow {
     class CPPCHECKLIB Value {
     public:
-        typedef std::pair<const Token *, std::string> ErrorPathItem;
-        typedef std::list<ErrorPathItem> ErrorPath;
-
         explicit Value(long long val = 0) : valueType(INT), intvalue(val), tokvalue(nullptr), floatValue(0.0), moveKind(NonMovedVariable), varvalue(val), condition(0), varId(0U), conditional(false), inconclusive(false), defaultArg(false), valueKind(ValueKind::Possible) {}
         Value(const Token *c, long long val);
 
@@ -113,6 +113,56 @@ namespace ValueFlow {
         /** Condition that this value depends on */
         const Token *condition;
 
+        /**
+         * Step in the path of a value. Only the tokens and the value are
+         * stored; the text is formatted by str() when the path is reported.
+         */
+        class CPPCHECKLIB ErrorPathItem {
+        public:
+            enum Kind { ASSIGNMENT, AFTER_LOOP, FUNCTION_ARGUMENT, CONDITION };
+
+            /**
+             * @param _kind kind of step
+             * @param _tok location of the step
+             * @param _context assignment (ASSIGNMENT), loop variable (AFTER_LOOP) or function name (FUNCTION_ARGUMENT)
+             * @param value value at this step
+             */
+            ErrorPathItem(Kind _kind, const Token *_tok, const Token *_context, const Value &value);
+
+            /** Function argument.
+             * @param _tok argument in the function call
+             * @param function function name
+             * @param _argnr argument number (0-based)
+             * @param _argument name of the argument in the function, may be null
+             * @param value value at this step
+             */
+            ErrorPathItem(const Token *_tok, const Token *function, unsigned int _argnr, const Token *_argument, const Value &value);
+
+            /** Condition that is assumed to be not redundant */
+            explicit ErrorPathItem(const Token *condition);
+
+            /** location of the step */
+            const Token *tok;
+
+            /** text of the step */
+            std::string str() const;
+
+        private:
+            std::string valueString() const;
+
+            Kind kind;
+            const Token *context;
+            const Token *argument;
+            unsigned int argnr;
+
+            // value at this step
+            ValueType valueType;
+            long long intvalue;
+            const Token *tokvalue;
+            double floatValue;
+        };
+        typedef std::list<ErrorPathItem> ErrorPath;
+
         ErrorPath errorPath;
 
         /** For calculated values - varId that calculated value depends on */
@@ -176,10 +226,20 @@ namespace ValueFlow {
     /// Constant folding of expression. This can be used before the full ValueFlow has been executed (ValueFlow::setValues).
     const ValueFlow::Value * valueFlowConstantFoldAST(const Token *expr, const Settings *settings);
 
-    /// Perform valueflow analysis.
-    void setValues(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings);
+    /// Perform valueflow analysis. If timerResults is given, each pass is timed separately.
+    /// If analyzerInformation is given, the return values of functions in other TUs of the build dir are used.
+    void setValues(TokenList *tokenlist, SymbolDatabase* symboldatabase, ErrorLogger *errorLogger, const Settings *settings, TimerResultsIntf *timerResults = nullptr, AnalyzerInformation *analyzerInformation = nullptr);
 
     std::string eitherTheConditionIsRedundant(const Token *condition);
+
+    /**
+     * Known return values of the global functions that do not depend on the
+     * arguments. They are stored in the build dir so the calls in other TUs
+     * get the value (see AnalyzerInformation::getReturnValue()).
+     * @param symboldatabase symbol database of the TU
+     * @param returnValues the values are added here by function key, "name(argument count)"
+     */
+    void getReturnValues(const SymbolDatabase *symboldatabase, std::map<std::string, long long> *returnValues);
 }
 
 #endif // valueflowH
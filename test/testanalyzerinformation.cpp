@@ -0,0 +1,223 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2016 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "analyzerinfo.h"
+#include "errorlogger.h"
+#include "importproject.h"
+#include "settings.h"
+#include "testsuite.h"
+#include "token.h"
+#include "tokenize.h"
+
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <map>
+#include <sstream>
+#include <string>
+
+
+class TestAnalyzerInformation : public TestFixture {
+public:
+    TestAnalyzerInformation() : TestFixture("TestAnalyzerInformation") {}
+
+private:
+
+    void run() {
+        TEST_CASE(returnValues);
+        TEST_CASE(returnValueConflict);
+        TEST_CASE(skipAnalysisReturnValue);
+        TEST_CASE(returnValueLookupsPerInstance);
+        TEST_CASE(returnValueOverload);
+    }
+
+    // The build dir is the working directory, the files are removed afterwards
+    static void removeFiles() {
+        std::remove("files.txt");
+        std::remove("ai1.a1");
+        std::remove("ai1.a1.retval");
+        std::remove("ai2.a1");
+        std::remove("ai2.a1.retval");
+    }
+
+    static void writeFilesTxt() {
+        removeFiles();
+        std::list<std::string> sourcefiles;
+        sourcefiles.push_back("ai1.c");
+        sourcefiles.push_back("ai2.c");
+        AnalyzerInformation::writeFilesTxt(".", sourcefiles, std::list<ImportProject::FileSettings>());
+    }
+
+    /** Analyze ai1.c, which returns the given value from f() */
+    static void analyzeReturnValue(long long value) {
+        AnalyzerInformation analyzerInformation;
+        std::list<ErrorLogger::ErrorMessage> errors;
+        analyzerInformation.analyzeFile(".", "ai1.c", "", 1U + static_cast<unsigned long long>(value), &errors);
+        std::map<std::string, long long> returnValues;
+        returnValues["f()"] = value;
+        analyzerInformation.setReturnValues(returnValues);
+    }
+
+    /** Analyze ai2.c, which calls f(). Returns false if the analysis is skipped */
+    static bool analyzeCall() {
+        AnalyzerInformation analyzerInformation;
+        std::list<ErrorLogger::ErrorMessage> errors;
+        if (!analyzerInformation.analyzeFile(".", "ai2.c", "", 1U, &errors))
+            return false;
+        long long value = 0;
+        analyzerInformation.getReturnValue(".", "f()", &value);
+        return true;
+    }
+
+    static std::string readFile(const char filename[]) {
+        std::ifstream fin(filename);
+        std::ostringstream ostr;
+        ostr << fin.rdbuf();
+        return ostr.str();
+    }
+
+    void returnValues() {
+        writeFilesTxt();
+        {
+            AnalyzerInformation analyzerInformation;
+            std::list<ErrorLogger::ErrorMessage> errors;
+            ASSERT_EQUALS(true, analyzerInformation.analyzeFile(".", "ai1.c", "", 1U, &errors));
+            std::map<std::string, long long> returnValues;
+            returnValues["f()"] = 42;
+            returnValues["g(int)"] = -3;
+            returnValues["h(int,int)"] = 0x123456789LL;
+            analyzerInformation.setReturnValues(returnValues);
+            // a value that differs between configurations is not stored
+            returnValues.clear();
+            returnValues["f()"] = 42;
+            returnValues["k()"] = 1;
+            analyzerInformation.setReturnValues(returnValues);
+            returnValues["k()"] = 2;
+            analyzerInformation.setReturnValues(returnValues);
+        }
+
+        AnalyzerInformation analyzerInformation;
+        long long value = 0;
+        ASSERT_EQUALS(true, analyzerInformation.getReturnValue(".", "f()", &value));
+        ASSERT_EQUALS(42, value);
+        ASSERT_EQUALS(true, analyzerInformation.getReturnValue(".", "g(int)", &value));
+        ASSERT_EQUALS(-3, value);
+        ASSERT_EQUALS(true, analyzerInformation.getReturnValue(".", "h(int,int)", &value));
+        ASSERT_EQUALS(0x123456789LL, value);
+        ASSERT_EQUALS(false, analyzerInformation.getReturnValue(".", "k()", &value));
+        ASSERT_EQUALS(false, analyzerInformation.getReturnValue(".", "x()", &value));
+        removeFiles();
+    }
+
+    void returnValueConflict() {
+        // Functions with different return values in different TUs are left out
+        writeFilesTxt();
+        analyzeReturnValue(1);
+        {
+            AnalyzerInformation analyzerInformation;
+            std::list<ErrorLogger::ErrorMessage> errors;
+            analyzerInformation.analyzeFile(".", "ai2.c", "", 1U, &errors);
+            std::map<std::string, long long> returnValues;
+            returnValues["f()"] = 2;
+            analyzerInformation.setReturnValues(returnValues);
+        }
+
+        AnalyzerInformation analyzerInformation;
+        long long value = 0;
+        ASSERT_EQUALS(false, analyzerInformation.getReturnValue(".", "f()", &value));
+        removeFiles();
+    }
+
+    void skipAnalysisReturnValue() {
+        writeFilesTxt();
+        ASSERT_EQUALS(true, analyzeCall());
+        ASSERT_EQUALS(false, analyzeCall());
+
+        // The return value appears
+        analyzeReturnValue(1);
+        ASSERT_EQUALS(true, analyzeCall());
+        ASSERT_EQUALS(false, analyzeCall());
+
+        // The return value changes
+        analyzeReturnValue(2);
+        ASSERT_EQUALS(true, analyzeCall());
+        ASSERT_EQUALS(false, analyzeCall());
+        removeFiles();
+    }
+
+    void returnValueLookupsPerInstance() {
+        // Closing the file of one instance does not drop the lookups of another one
+        writeFilesTxt();
+        analyzeReturnValue(1);
+        {
+            AnalyzerInformation analyzerInformation1;
+            AnalyzerInformation analyzerInformation2;
+            std::list<ErrorLogger::ErrorMessage> errors;
+            analyzerInformation1.analyzeFile(".", "ai2.c", "", 1U, &errors);
+            long long value = 0;
+            analyzerInformation1.getReturnValue(".", "f()", &value);
+            analyzerInformation2.analyzeFile(".", "ai1.c", "", 3U, &errors);
+            analyzerInformation2.close();
+        }
+        ASSERT(readFile("ai2.a1").find("<ReturnValue function=\"f()\" value=\"1\"/>") != std::string::npos);
+        ASSERT(readFile("ai1.a1").find("<ReturnValue") == std::string::npos);
+        removeFiles();
+    }
+
+    /** Known value of the first call of the given function in ai2.c */
+    static bool knownCallValue(const char code[], const char call[], long long *value) {
+        Settings settings;
+        settings.buildDir = ".";
+        AnalyzerInformation analyzerInformation;
+        std::list<ErrorLogger::ErrorMessage> errors;
+        analyzerInformation.analyzeFile(".", "ai2.c", "", 1U, &errors);
+        Tokenizer tokenizer(&settings, nullptr);
+        tokenizer.setAnalyzerInformation(&analyzerInformation);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+        const Token *tok = Token::findsimplematch(tokenizer.tokens(), call);
+        if (!tok || !tok->next()->hasKnownIntValue())
+            return false;
+        *value = tok->next()->values().front().intvalue;
+        return true;
+    }
+
+    void returnValueOverload() {
+        // ai1.c defines 'int f(int) { return 0; }', f(double) is defined in some other TU
+        writeFilesTxt();
+        {
+            AnalyzerInformation analyzerInformation;
+            std::list<ErrorLogger::ErrorMessage> errors;
+            analyzerInformation.analyzeFile(".", "ai1.c", "", 1U, &errors);
+            std::map<std::string, long long> returnValues;
+            returnValues["f(int)"] = 0;
+            analyzerInformation.setReturnValues(returnValues);
+        }
+        const char code[] = "int f(int);\n"
+                            "int f(double);\n"
+                            "void g() { int a = f(1); int b = f(1.0); }";
+        long long value = 1;
+        ASSERT_EQUALS(true, knownCallValue(code, "f ( 1 )", &value));
+        ASSERT_EQUALS(0, value);
+        ASSERT_EQUALS(false, knownCallValue(code, "f ( 1.0 )", &value));
+        removeFiles();
+    }
+};
+
+REGISTER_TEST(TestAnalyzerInformation)
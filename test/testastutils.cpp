@@ -34,6 +34,7 @@ private:
 
     void run() {
         TEST_CASE(isReturnScope);
+        TEST_CASE(expressionHash);
     }
 
     bool isReturnScope(const char code[], int offset) {
@@ -54,6 +55,26 @@ private:
         ASSERT_EQUALS(true, isReturnScope("void f() { if (a) { {throw new string(x);}; } }", -4)); // #7144
         ASSERT_EQUALS(true, isReturnScope("void f() { if (a) { {throw new string(x);}; } }", -2)); // #7144
     }
+
+    bool sameHash(const char code[], const char expr1[], const char expr2[]) {
+        Settings settings;
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+        const Token * const tok1 = Token::findsimplematch(tokenizer.tokens(), expr1);
+        const Token * const tok2 = Token::findsimplematch(tok1->next(), expr2);
+        return ::expressionHash(tok1->tokAt(2)) == ::expressionHash(tok2->tokAt(2));
+    }
+
+    void expressionHash() {
+        ASSERT_EQUALS(true, sameHash("void f(int a, int b) { x = a < b; y = b > a; }", "= a <", "= b >"));
+        ASSERT_EQUALS(true, sameHash("void f(int a, int b) { x = a <= b; y = b >= a; }", "= a <=", "= b >="));
+        ASSERT_EQUALS(true, sameHash("void f(int a, int b) { x = a + b; y = b + a; }", "= a +", "= b +"));
+        ASSERT_EQUALS(true, sameHash("void f(int a, int b) { x = a == b; y = b == a; }", "= a ==", "= b =="));
+        ASSERT_EQUALS(false, sameHash("void f(int a, int b) { x = a - b; y = b - a; }", "= a -", "= b -"));
+        ASSERT_EQUALS(false, sameHash("void f(int a, int b) { x = a < b; y = b < a; }", "= a <", "= b <"));
+        ASSERT_EQUALS(false, sameHash("void f(int a, int b) { x = a + b; y = a + 1; }", "= a +", "= a +"));
+    }
 };
 
 REGISTER_TEST(TestAstUtils)
@@ -54,6 +54,7 @@ private:
         TEST_CASE(verboselong);
         TEST_CASE(debug);
         TEST_CASE(debugwarnings);
+        TEST_CASE(debugsimplifyrules);
         TEST_CASE(forceshort);
         TEST_CASE(forcelong);
         TEST_CASE(relativePaths);
@@ -97,6 +98,8 @@ private:
         TEST_CASE(jobs);
         TEST_CASE(jobsMissingCount);
         TEST_CASE(jobsInvalid);
+        TEST_CASE(functionJobs);
+        TEST_CASE(functionJobsInvalid);
         TEST_CASE(maxConfigs);
         TEST_CASE(maxConfigsMissingCount);
         TEST_CASE(maxConfigsInvalid);
@@ -126,6 +129,7 @@ private:
         TEST_CASE(xmlverinvalid);
         TEST_CASE(doc);
         TEST_CASE(showtime);
+        TEST_CASE(showtimetree);
         TEST_CASE(errorlist1);
         TEST_CASE(errorlistverbose1);
         TEST_CASE(errorlistverbose2);
@@ -241,6 +245,14 @@ private:
         ASSERT_EQUALS(true, settings.debugwarnings);
     }
 
+    void debugsimplifyrules() {
+        REDIRECT;
+        const char *argv[] = {"cppcheck", "--debug-simplify-rules", "file.cpp"};
+        settings.debugSimplifyRules = false;
+        ASSERT(defParser.ParseFromArgs(3, argv));
+        ASSERT_EQUALS(true, settings.debugSimplifyRules);
+    }
+
     void forceshort() {
         REDIRECT;
         const char *argv[] = {"cppcheck", "-f", "file.cpp"};
@@ -649,6 +661,21 @@ private:
         ASSERT_EQUALS(false, defParser.ParseFromArgs(4, argv));
     }
 
+    void functionJobs() {
+        REDIRECT;
+        const char *argv[] = {"cppcheck", "--function-jobs=4", "file.cpp"};
+        settings.functionJobs = 1;
+        ASSERT(defParser.ParseFromArgs(3, argv));
+        ASSERT_EQUALS(4, settings.functionJobs);
+    }
+
+    void functionJobsInvalid() {
+        REDIRECT;
+        const char *argv[] = {"cppcheck", "--function-jobs=0", "file.cpp"};
+        // Fails since at least one process is needed
+        ASSERT_EQUALS(false, defParser.ParseFromArgs(3, argv));
+    }
+
     void maxConfigs() {
         REDIRECT;
         const char *argv[] = {"cppcheck", "-f", "--max-configs=12", "file.cpp"};
@@ -903,6 +930,14 @@ private:
         ASSERT(settings.showtime == SHOWTIME_SUMMARY);
     }
 
+    void showtimetree() {
+        REDIRECT;
+        const char *argv[] = {"cppcheck", "--showtime=tree"};
+        settings.showtime = SHOWTIME_NONE;
+        ASSERT(defParser.ParseFromArgs(2, argv));
+        ASSERT(settings.showtime == SHOWTIME_TREE);
+    }
+
     void errorlist1() {
         REDIRECT;
         const char *argv[] = {"cppcheck", "--errorlist"};
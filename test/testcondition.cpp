@@ -600,6 +600,20 @@ private:
               "  else if (x & 0x08) {}\n"
               "}");
         ASSERT_EQUALS("[test.cpp:3]: (style) Expression is always false because 'else if' condition matches previous condition at line 2.\n", errout.str());
+
+        // long chain, several matches are reported in order
+        check("void f(int x, int y) {\n"
+              "  if (x < y) {}\n"
+              "  else if (x == 1) {}\n"
+              "  else if (x & 3) {}\n"
+              "  else if (y > x) {}\n"
+              "  else if (1 == x) {}\n"
+              "  else if (x == 2) {}\n"
+              "}");
+        ASSERT_EQUALS("[test.cpp:5]: (style) Expression is always false because 'else if' condition matches previous condition at line 2.\n"
+                      "[test.cpp:6]: (style) Expression is always false because 'else if' condition matches previous condition at line 3.\n"
+                      "[test.cpp:6]: (style) Expression is always false because 'else if' condition matches previous condition at line 4.\n"
+                      "[test.cpp:7]: (style) Expression is always false because 'else if' condition matches previous condition at line 4.\n", errout.str());
     }
 
     void checkBadBitmaskCheck() {
@@ -0,0 +1,150 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2016 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "controlflow.h"
+#include "settings.h"
+#include "symboldatabase.h"
+#include "testsuite.h"
+#include "token.h"
+#include "tokenize.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+class TestControlFlow : public TestFixture {
+public:
+    TestControlFlow() : TestFixture("TestControlFlow") {
+    }
+
+private:
+    Settings settings;
+
+    void run() {
+        TEST_CASE(straight);
+        TEST_CASE(ifElse);
+        TEST_CASE(loops);
+        TEST_CASE(switchCase);
+        TEST_CASE(jumps);
+        TEST_CASE(tryCatch);
+        TEST_CASE(invalid);
+        TEST_CASE(solve);
+    }
+
+    /** Edges of the graph of the first function, "from>to,to from>to ..", or "invalid" */
+    std::string edges(const char code[]) {
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+        const ControlFlowGraph cfg(tokenizer.getSymbolDatabase()->functionScopes.front());
+        if (!cfg.isValid())
+            return "invalid";
+        std::ostringstream ret;
+        const std::vector<ControlFlowGraph::BasicBlock> &blocks = cfg.blocks();
+        for (std::size_t b = 0; b < blocks.size(); ++b) {
+            if (blocks[b].successors.empty())
+                continue;
+            ret << (ret.tellp() > 0 ? " " : "") << b << '>';
+            for (std::size_t s = 0; s < blocks[b].successors.size(); ++s)
+                ret << (s ? "," : "") << blocks[b].successors[s];
+        }
+        return ret.str();
+    }
+
+    void straight() {
+        ASSERT_EQUALS("0>2 2>1", edges("void f() { a(); b(); }"));
+        ASSERT_EQUALS("0>2 2>1", edges("void f() { a(); { b(); } }"));
+    }
+
+    void ifElse() {
+        // 2: condition, 3: then, 4: join
+        ASSERT_EQUALS("0>2 2>3,4 3>4 4>1", edges("void f(int x) { if (x) { a(); } b(); }"));
+        // 5: else
+        ASSERT_EQUALS("0>2 2>3,5 3>4 4>1 5>4", edges("void f(int x) { if (x) { a(); } else { b(); } }"));
+    }
+
+    void loops() {
+        // 3: head, 4: body, 5: after
+        ASSERT_EQUALS("0>2 2>3 3>4,5 4>3 5>1", edges("void f(int x) { a(); while (x) { x--; } }"));
+        // for: 3: condition, 4: increment, 5: body, 6: after
+        ASSERT_EQUALS("0>2 2>3 3>5,6 4>3 5>4 6>1", edges("void f() { for (int i = 0; i < 10; i++) { a(); } }"));
+        // the block after the loop is not reachable
+        ASSERT_EQUALS("0>2 2>3 3>5 4>3 5>4 6>1", edges("void f() { for (;;) { a(); } }"));
+        // do: 3: body, 4: condition, 5: after
+        ASSERT_EQUALS("0>2 2>3 3>4 4>3,5 5>1", edges("void f(int x) { do { x--; } while (x); }"));
+        // break and continue
+        ASSERT_EQUALS("0>2 2>3 3>4,5 4>6,8 5>1 6>5 7>8 8>3 9>3", edges("void f(int x) { while (x) { if (x == 3) { break; } continue; } }"));
+    }
+
+    void switchCase() {
+        // 3: after, 4: before the first case, 5: case 1, 7: case 2
+        ASSERT_EQUALS("0>2 2>5,7,3 3>1 4>5 5>3 6>7 7>3", edges("void f(int x) { switch (x) { case 1: a(); break; case 2: b(); } }"));
+        // with default there is no edge from the condition to the end
+        ASSERT_EQUALS("0>2 2>5,7 3>1 4>5 5>3 6>7 7>3", edges("void f(int x) { switch (x) { case 1: a(); break; default: b(); } }"));
+    }
+
+    void jumps() {
+        // code after return is not reachable
+        ASSERT_EQUALS("0>2 2>3,5 3>1 4>5 5>1", edges("void f(int x) { if (x) { return; } a(); }"));
+        // 3: label
+        ASSERT_EQUALS("0>2 2>3 3>3 4>1", edges("void f() { a(); l: b(); goto l; }"));
+        ASSERT_EQUALS("invalid", edges("void f() { goto l; }"));
+    }
+
+    void tryCatch() {
+        // 3: try, 4: after, 5: handler. Every block in the try block may throw
+        ASSERT_EQUALS("0>2 2>3,5 3>4,5 4>1 5>4", edges("void f() { try { a(); } catch (...) { b(); } }"));
+    }
+
+    void invalid() {
+        ASSERT_EQUALS("invalid", edges("void f() { break; }"));
+    }
+
+    void solve() {
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr("void f(int x) { if (x) { a(); } else { b(); } }");
+        tokenizer.tokenize(istr, "test.cpp");
+        const ControlFlowGraph cfg(tokenizer.getSymbolDatabase()->functionScopes.front());
+        ASSERT_EQUALS(6U, cfg.blocks().size());
+
+        // fact 0 is generated in then (3), fact 1 in then and else (3, 5)
+        std::vector<std::vector<bool> > gen(6U, std::vector<bool>(2U, false));
+        const std::vector<std::vector<bool> > kill(6U, std::vector<bool>(2U, false));
+        gen[3][0] = gen[3][1] = gen[5][1] = true;
+        const std::vector<bool> boundary(2U, false);
+
+        const std::vector<std::vector<bool> > must = cfg.solve(ControlFlowGraph::FORWARD, ControlFlowGraph::INTERSECTION, gen, kill, boundary);
+        ASSERT_EQUALS(false, must[ControlFlowGraph::EXIT][0]);
+        ASSERT_EQUALS(true, must[ControlFlowGraph::EXIT][1]);
+
+        const std::vector<std::vector<bool> > may = cfg.solve(ControlFlowGraph::FORWARD, ControlFlowGraph::UNION, gen, kill, boundary);
+        ASSERT_EQUALS(true, may[ControlFlowGraph::EXIT][0]);
+        ASSERT_EQUALS(true, may[ControlFlowGraph::EXIT][1]);
+
+        // backward: facts used in the else block are live at the condition
+        std::vector<std::vector<bool> > use(6U, std::vector<bool>(2U, false));
+        use[5][0] = true;
+        const std::vector<std::vector<bool> > live = cfg.solve(ControlFlowGraph::BACKWARD, ControlFlowGraph::UNION, use, kill, boundary);
+        ASSERT_EQUALS(true, live[2][0]);
+        ASSERT_EQUALS(false, live[3][0]);
+    }
+};
+
+REGISTER_TEST(TestControlFlow)
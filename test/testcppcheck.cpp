@@ -19,10 +19,13 @@
 #include "check.h"
 #include "cppcheck.h"
 #include "errorlogger.h"
+#include "settings.h"
 #include "testsuite.h"
+#include "tokenize.h"
 
 #include <algorithm>
 #include <list>
+#include <sstream>
 #include <string>
 
 
@@ -36,12 +39,80 @@ private:
     class ErrorLogger2 : public ErrorLogger {
     public:
         std::list<std::string> id;
+        std::list<std::string> text;
 
         void reportOut(const std::string & /*outmsg*/) {
         }
 
         void reportErr(const ErrorLogger::ErrorMessage &msg) {
             id.push_back(msg._id);
+            text.push_back(msg.toString(false));
+        }
+    };
+
+    /** Reports a style message without testing if style is enabled */
+    class CheckProbe : public Check {
+    public:
+        CheckProbe() : Check("Probe") {
+        }
+
+        CheckProbe(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger)
+            : Check("Probe", tokenizer, settings, errorLogger) {
+        }
+
+        void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) {
+            CheckProbe c(tokenizer, settings, errorLogger);
+            c.probeError(tokenizer->tokens());
+        }
+
+        void runSimplifiedChecks(const Tokenizer *, const Settings *, ErrorLogger *) {
+        }
+
+        void getErrorMessages(ErrorLogger *errorLogger, const Settings *settings) const {
+            CheckProbe c(nullptr, settings, errorLogger);
+            c.probeError(nullptr);
+        }
+
+        std::string classInfo() const {
+            return "";
+        }
+
+    private:
+        void probeError(const Token *tok) {
+            reportError(tok, Severity::style, "probe", "Probe");
+        }
+    };
+
+    /** Reports a warning that it lists as a style error */
+    class CheckUnlisted : public Check {
+    public:
+        CheckUnlisted() : Check("Unlisted") {
+        }
+
+        CheckUnlisted(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger)
+            : Check("Unlisted", tokenizer, settings, errorLogger) {
+        }
+
+        void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger) {
+            CheckUnlisted c(tokenizer, settings, errorLogger);
+            c.unlistedError(tokenizer->tokens(), Severity::warning);
+        }
+
+        void runSimplifiedChecks(const Tokenizer *, const Settings *, ErrorLogger *) {
+        }
+
+        void getErrorMessages(ErrorLogger *errorLogger, const Settings *settings) const {
+            CheckUnlisted c(nullptr, settings, errorLogger);
+            c.unlistedError(nullptr, Severity::style);
+        }
+
+        std::string classInfo() const {
+            return "";
+        }
+
+    private:
+        void unlistedError(const Token *tok, Severity::SeverityType severity) {
+            reportError(tok, severity, "unlisted", "Unlisted");
         }
     };
 
@@ -49,6 +120,14 @@ private:
         TEST_CASE(instancesSorted);
         TEST_CASE(classInfoFormat);
         TEST_CASE(getErrorMessages);
+        TEST_CASE(needsSimplifiedTokens);
+        TEST_CASE(functionJobs);
+        TEST_CASE(functionJobsSplitChecks);
+        TEST_CASE(purgedConfiguration);
+        TEST_CASE(enabledChecks);
+        TEST_CASE(enabledChecksDefault);
+        TEST_CASE(reportedErrorsAreListed);
+        TEST_CASE(unlistedError);
     }
 
     void instancesSorted() const {
@@ -91,6 +170,209 @@ private:
         }
         ASSERT_EQUALS("", duplicate);
     }
+
+    static const Check *findCheck(const std::string &name) {
+        for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
+            if ((*it)->name() == name)
+                return *it;
+        }
+        return nullptr;
+    }
+
+    bool needsSimplifiedTokens(const std::string &checkName, const char code[], const char filename[], const Settings &settings) const {
+        const Check *check = findCheck(checkName);
+        ASSERT(check != nullptr);
+        Tokenizer tokenizer(&settings, nullptr);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, filename);
+        return check && check->needsSimplifiedTokens(&tokenizer, &settings);
+    }
+
+    void needsSimplifiedTokens() const {
+        Settings settings;
+        ASSERT_EQUALS(false, needsSimplifiedTokens("Type", "int x;", "test.cpp", settings));
+        ASSERT_EQUALS(false, needsSimplifiedTokens("Class", "int x;", "test.c", settings));
+        ASSERT_EQUALS(true, needsSimplifiedTokens("Class", "int x;", "test.cpp", settings));
+        ASSERT_EQUALS(false, needsSimplifiedTokens("Using postfix operators", "int x;", "test.cpp", settings));
+        settings.addEnabled("performance");
+        ASSERT_EQUALS(true, needsSimplifiedTokens("Using postfix operators", "int x;", "test.cpp", settings));
+        ASSERT_EQUALS(false, needsSimplifiedTokens("Using postfix operators", "int x;", "test.c", settings));
+    }
+
+    /** Runs the parts one after another in this process */
+    class SequentialPartsExecutor : public PartsExecutor {
+    public:
+        bool run(CppCheck &cppcheck, const Tokenizer &tokenizer, bool simplified, std::size_t parts, ErrorLogger &errorLogger, std::string * /*failure*/) {
+            for (std::size_t part = 0; part < parts; ++part)
+                cppcheck.runChecksOfPart(tokenizer, simplified, part, errorLogger);
+            return true;
+        }
+    };
+
+    static std::list<std::string> checkFunctionJobs(const char code[], unsigned int functionJobs, const char filename[] = "test.c") {
+        ErrorLogger2 errorLogger;
+        CppCheck cppcheck(errorLogger, false);
+        SequentialPartsExecutor partsExecutor;
+        cppcheck.setPartsExecutor(&partsExecutor);
+        cppcheck.settings().addEnabled("warning,style,performance,portability");
+        cppcheck.settings().inconclusive = true;
+        cppcheck.settings().functionJobs = functionJobs;
+        cppcheck.check(filename, code);
+        errorLogger.text.sort();
+        return errorLogger.text;
+    }
+
+    void functionJobs() const {
+        // checkFileUsage() resets all FILE pointers at 'return'
+        const char code[] = "void f1(int *p) { if (p) {} *p = 0; }\n"
+                            "void f2() { char a[10]; a[10] = 0; }\n"
+                            "void f3() { return; }\n"
+                            "void f4() { FILE *f; fwrite(\"x\", 1, 1, f); }\n"
+                            "void f5() { char *s = malloc(10); }\n"
+                            "void f6() { int x; x = x; }\n"
+                            "void f7() { char *s = malloc(10); free(s); free(s); }\n";
+        const std::list<std::string> expected = checkFunctionJobs(code, 1);
+        ASSERT(expected.size() >= 5U);
+        ASSERT_EQUALS(true, expected == checkFunctionJobs(code, 3));
+        ASSERT_EQUALS(true, expected == checkFunctionJobs(code, 20));
+    }
+
+    void functionJobsSplitChecks() const {
+        // The checks that can split the function scopes report each error once
+        const char code[] = "int *f1() { int x; return &x; }\n"
+                            "void f2() { char *s = new char[10]; }\n"
+                            "void f3(std::vector<int> &v) { for (std::vector<int>::iterator it = v.begin(); it != v.end(); it++) {} }\n"
+                            "int f4(int *p) { return p; }\n"
+                            "void f5(std::vector<int> &v) { BOOST_FOREACH(int i, v) { v.push_back(i); } }\n"
+                            "void f6(int *p) { int a; p = &a; }\n"
+                            "class A { void f7(); void f8(); int x; };\n"
+                            "void A::f7() { int y; y = x; }\n"
+                            "void A::f8() { int z = 0; }\n";
+        const std::list<std::string> expected = checkFunctionJobs(code, 1, "test.cpp");
+        ASSERT(expected.size() >= 6U);
+        ASSERT_EQUALS(true, expected == checkFunctionJobs(code, 2, "test.cpp"));
+        ASSERT_EQUALS(true, expected == checkFunctionJobs(code, 20, "test.cpp"));
+    }
+
+    void purgedConfiguration() const {
+        // The token list is the same for both configurations, the second one is not checked
+        ErrorLogger2 errorLogger;
+        CppCheck cppcheck(errorLogger, false);
+        cppcheck.settings().addEnabled("warning");
+        cppcheck.settings().addEnabled("information");
+        cppcheck.settings().verbose = true;
+        cppcheck.check("test.c", "#ifdef A\n"
+                       "#endif\n"
+                       "void f() { char a[10]; a[10] = 0; }\n");
+        ASSERT_EQUALS(1, std::count(errorLogger.id.begin(), errorLogger.id.end(), "purgedConfiguration"));
+        ASSERT_EQUALS(1, std::count(errorLogger.id.begin(), errorLogger.id.end(), "arrayIndexOutOfBounds"));
+    }
+
+    static std::size_t checkProbe(const char enabled[], const char suppression[], bool *suppressionMatched = nullptr) {
+        ErrorLogger2 errorLogger;
+        CppCheck cppcheck(errorLogger, true);
+        cppcheck.settings().addEnabled(enabled);
+        cppcheck.settings().nomsg.addSuppressionLine(suppression);
+        cppcheck.check("test.c", "int x;\n");
+        if (suppressionMatched)
+            *suppressionMatched = cppcheck.settings().nomsg.getUnmatchedGlobalSuppressions(false).empty();
+        return std::count(errorLogger.id.begin(), errorLogger.id.end(), "probe");
+    }
+
+    void enabledChecks() const {
+        const CheckProbe probe;
+
+        // The probe is not run if its only error is disabled or suppressed everywhere
+        ASSERT_EQUALS(0U, checkProbe("warning", ""));
+        ASSERT_EQUALS(1U, checkProbe("style", ""));
+        ASSERT_EQUALS(0U, checkProbe("style", "probe"));
+        ASSERT_EQUALS(1U, checkProbe("style", "probe:other.c"));
+
+        // With --enable=information unmatched suppressions are reported, so the probe is run
+        bool matched = false;
+        ASSERT_EQUALS(0U, checkProbe("style,information", "probe", &matched));
+        ASSERT_EQUALS(true, matched);
+    }
+
+    void enabledChecksDefault() {
+        // Errors that a check reports but another check lists are not dropped
+        ErrorLogger2 errorLogger;
+        CppCheck cppcheck(errorLogger, false);
+        LOAD_LIB_2(cppcheck.settings().library, "std.cfg");
+        cppcheck.check("test.cpp", "class Fred { Fred() { p = new int[10]; } ~Fred() { free(p); } int *p; };\n");
+        ASSERT_EQUALS(1, std::count(errorLogger.id.begin(), errorLogger.id.end(), "mismatchAllocDealloc"));
+    }
+
+    void reportedErrorsAreListed() {
+        // The errors that a check reports are listed by its getErrorMessages() or unlistedErrors()
+        Settings settings;
+        settings.addEnabled("all");
+        settings.inconclusive = true;
+        settings.experimental = true;
+        settings.checkLibrary = true;
+        LOAD_LIB_2(settings.library, "std.cfg");
+
+        static const char * const code[][2] = {
+            { "test.cpp", "class Fred { Fred() { p = new int[10]; } ~Fred() { free(p); } int *p; };" },
+            { "test.c", "struct S { char *p; }; void f() { struct S s; s.p = malloc(10); }" },
+            { "test.c", "void f() { char *p = malloc(10); }" },
+            { "test.c", "void f() { char *p = malloc(10); free(p); *p = 0; }" },
+            { "test.cpp", "void f() { char *p = malloc(10); delete p; }" },
+            { "test.c", "void f() { char *p = alloca(10); }" },
+            { "test.cpp", "void f() { char *p = alloca(10); unknown(p); }" },
+            { "test.cpp", "void f(bool b) { if (b > true) {} }" },
+            { "test.cpp", "class A { virtual void f() = 0; A() { f(); } };" },
+            { "test.cpp", "void f() { char s[10]; scanf(\"%5s\", s); }" },
+            { "test.cpp", "void f() { char *p = malloc(10); free(p + 1); }" },
+            { "test.cpp", "void f(int a) { int y = 1; switch (a) { case 2: y |= 3; case 3: y |= 3; break; } }" },
+            { "test.cpp", "void f() { std::string errmsg; throw errmsg.c_str(); }" },
+            { "test.cpp", "void f(char *s) { if (!s) {} p = s - 20; }" }
+        };
+
+        ErrorLogger2 all;
+        for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it)
+            (*it)->getErrorMessages(&all, &settings);
+
+        for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
+            // The ids of the unlisted errors are listed by some check
+            const Check::ErrorIds unlisted = (*it)->unlistedErrors();
+            for (Check::ErrorIds::const_iterator error = unlisted.begin(); error != unlisted.end(); ++error)
+                ASSERT_EQUALS(true, std::find(all.id.begin(), all.id.end(), error->first) != all.id.end());
+
+            ErrorLogger2 listed;
+            const Check::ErrorIds listedErrors = (*it)->listedErrors(settings);
+            for (Check::ErrorIds::const_iterator error = listedErrors.begin(); error != listedErrors.end(); ++error)
+                listed.id.push_back(error->first);
+
+            for (std::size_t i = 0; i < sizeof(code) / sizeof(code[0]); ++i) {
+                ErrorLogger2 reported;
+                Tokenizer tokenizer(&settings, this);
+                std::istringstream istr(code[i][1]);
+                tokenizer.tokenize(istr, code[i][0]);
+                (*it)->runChecks(&tokenizer, &settings, &reported);
+                tokenizer.simplifyTokenList2();
+                (*it)->runSimplifiedChecks(&tokenizer, &settings, &reported);
+
+                for (std::list<std::string>::const_iterator id = reported.id.begin(); id != reported.id.end(); ++id) {
+                    if (std::find(listed.id.begin(), listed.id.end(), *id) == listed.id.end())
+                        ASSERT_EQUALS("", (*it)->name() + ": " + *id);
+                }
+            }
+        }
+    }
+
+    void unlistedError() {
+#ifndef NDEBUG
+        // In debug builds an error that the check does not list is an internal error
+        CheckUnlisted unlisted;
+        Settings settings;
+        settings.addEnabled("warning");
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr("int x;");
+        tokenizer.tokenize(istr, "test.c");
+        ASSERT_THROW(unlisted.runChecks(&tokenizer, &settings, this), InternalError);
+#endif
+    }
 };
 
 REGISTER_TEST(TestCppcheck)
@@ -63,6 +63,8 @@ private:
         TEST_CASE(SerializeSanitize);
 
         TEST_CASE(suppressUnmatchedSuppressions);
+
+        TEST_CASE(progressReporter);
     }
 
     void TestPatternSearchReplace(const std::string& idPlaceholder, const std::string& id) const {
@@ -388,6 +390,33 @@ private:
         reportUnmatchedSuppressions(suppressions);
         ASSERT_EQUALS("[a.c:10]: (information) Unmatched suppression: abc\n", errout.str());
     }
+
+    void progressReporter() {
+        class ProgressLogger : public ErrorLogger {
+        public:
+            ProgressLogger() : count(0), value(0) {}
+            void reportOut(const std::string &) {}
+            void reportErr(const ErrorLogger::ErrorMessage &) {}
+            void reportProgress(const std::string &, const char [], const std::size_t v) {
+                ++count;
+                value = v;
+            }
+            unsigned int count;
+            std::size_t value;
+        };
+
+        const std::string filename("test.cpp");
+        ProgressLogger logger;
+        ProgressReporter progress(&logger, filename, "test");
+        for (std::size_t i = 1; i <= 3 * ProgressReporter::interval; ++i)
+            progress.report(i);
+        ASSERT_EQUALS(3U, logger.count);
+        ASSERT_EQUALS(3 * ProgressReporter::interval, logger.value);
+
+        // no error logger => nothing is reported
+        ProgressReporter disabled(nullptr, filename, "test");
+        disabled.report(0);
+    }
 };
 
 REGISTER_TEST(TestErrorLogger)
@@ -4,6 +4,7 @@ INCLUDEPATH += ../externals/tinyxml
 
 
 SOURCES += $${BASEPATH}/test64bit.cpp \
+           $${BASEPATH}/testanalyzerinformation.cpp \
            $${BASEPATH}/testassert.cpp \
            $${BASEPATH}/testastutils.cpp \
            $${BASEPATH}/testautovariables.cpp \
@@ -15,10 +16,12 @@ SOURCES += $${BASEPATH}/test64bit.cpp \
            $${BASEPATH}/testcmdlineparser.cpp \
            $${BASEPATH}/testcondition.cpp \
            $${BASEPATH}/testconstructors.cpp \
+           $${BASEPATH}/testcontrolflow.cpp \
            $${BASEPATH}/testcppcheck.cpp \
            $${BASEPATH}/testerrorlogger.cpp \
            $${BASEPATH}/testexceptionsafety.cpp \
            $${BASEPATH}/testfilelister.cpp \
+           $${BASEPATH}/testfunctionexecutor.cpp \
            $${BASEPATH}/testfunctions.cpp \
            $${BASEPATH}/testgarbage.cpp \
            $${BASEPATH}/testimportproject.cpp \
@@ -52,6 +55,7 @@ SOURCES += $${BASEPATH}/test64bit.cpp \
            $${BASEPATH}/testtoken.cpp \
            $${BASEPATH}/testtokenize.cpp \
            $${BASEPATH}/testtokenlist.cpp \
+           $${BASEPATH}/testtokenvisitor.cpp \
            $${BASEPATH}/testtype.cpp \
            $${BASEPATH}/testuninitvar.cpp \
            $${BASEPATH}/testunusedfunctions.cpp \
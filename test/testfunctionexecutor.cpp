@@ -0,0 +1,142 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2016 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cppcheck.h"
+#include "errorlogger.h"
+#include "functionexecutor.h"
+#include "mathlib.h"
+#include "settings.h"
+#include "testsuite.h"
+
+#include <list>
+#include <string>
+
+class TestFunctionExecutor : public TestFixture {
+public:
+    TestFunctionExecutor() : TestFixture("TestFunctionExecutor") {
+    }
+
+private:
+    /** Collects the XML version 2 output and the columns of the locations */
+    class ErrorLoggerXml : public ErrorLogger {
+    public:
+        std::list<std::string> xml;
+        std::string out;
+
+        void reportOut(const std::string &outmsg) {
+            out += outmsg;
+        }
+
+        void reportErr(const ErrorLogger::ErrorMessage &msg) {
+            std::string columns;
+            for (std::list<ErrorLogger::ErrorMessage::FileLocation>::const_iterator loc = msg._callStack.begin(); loc != msg._callStack.end(); ++loc)
+                columns += " col=" + MathLib::toString(loc->col);
+            xml.push_back(msg.toXML(false, 2) + columns);
+        }
+    };
+
+    static std::list<std::string> check(const char code[], unsigned int functionJobs, const char enabled[] = "warning,style,performance,portability") {
+        ErrorLoggerXml errorLogger;
+        CppCheck cppcheck(errorLogger, false);
+        FunctionExecutor functionExecutor;
+        cppcheck.setPartsExecutor(&functionExecutor);
+        if (*enabled)
+            cppcheck.settings().addEnabled(enabled);
+        cppcheck.settings().functionJobs = functionJobs;
+        cppcheck.check("test.c", code);
+        errorLogger.xml.sort();
+        return errorLogger.xml;
+    }
+
+    static std::string packet(char type, const std::string &data) {
+        return type + MathLib::toString(data.size()) + ' ' + data;
+    }
+
+    void run() {
+        TEST_CASE(sameErrors);
+        TEST_CASE(header);
+        TEST_CASE(childOutput);
+        TEST_CASE(malformedChildOutput);
+    }
+
+    void sameErrors() const {
+        if (!FunctionExecutor::isEnabled()) {
+            // Skip this check on systems which don't use this feature
+            return;
+        }
+        const char code[] = "void f1(int *p) { if (p) {} *p = 0; }\n"
+                            "void f2() { char a[10]; a[10] = 0; }\n"
+                            "void f3() { return; }\n"
+                            "void f5() { char *s = malloc(10); }\n"
+                            "void f6() { int x; x = x; }\n"
+                            "void f7() { char *s = malloc(10); free(s); free(s); }\n";
+        const std::list<std::string> expected = check(code, 1);
+        ASSERT(expected.size() >= 4U);
+        ASSERT_EQUALS(true, expected == check(code, 3));
+        ASSERT_EQUALS(true, expected == check(code, 20));
+    }
+
+    void header() const {
+        if (!FunctionExecutor::isEnabled())
+            return;
+        // file0 and the columns of errors in a header are kept
+        const char code[] = "#line 1 \"test.h\"\n"
+                            "void f1() { char a[10]; a[10] = 0; }\n"
+                            "void f2() { char b[10]; b[10] = 0; }\n";
+        const std::list<std::string> expected = check(code, 1, "");
+        ASSERT_EQUALS(2U, expected.size());
+        ASSERT(expected.front().find("file0=\"test.c\" file=\"test.h\"") != std::string::npos);
+        ASSERT(expected.front().find(" col=0") == std::string::npos);
+        ASSERT_EQUALS(true, expected == check(code, 2, ""));
+    }
+
+    void childOutput() const {
+        std::list<ErrorLogger::ErrorMessage::FileLocation> callstack;
+        callstack.push_back(ErrorLogger::ErrorMessage::FileLocation("test.h", 2));
+        callstack.back().col = 7;
+        const ErrorLogger::ErrorMessage msg(callstack, "test.c", Severity::error, "Array index out of bounds.", "arrayIndexOutOfBounds", false);
+
+        ErrorLoggerXml errorLogger;
+        const std::string data = packet('O', "Checking test.c ...") +
+                                 packet('E', packet('F', "test.c") + packet('L', "7 ") + packet('M', msg.serialize()));
+        ASSERT_EQUALS(true, FunctionExecutor::reportChildOutput(data, errorLogger));
+        ASSERT_EQUALS("Checking test.c ...", errorLogger.out);
+        ASSERT_EQUALS(1U, errorLogger.xml.size());
+        ASSERT(errorLogger.xml.front().find("file0=\"test.c\" file=\"test.h\" line=\"2\"") != std::string::npos);
+        ASSERT(errorLogger.xml.front().find(" col=7") != std::string::npos);
+    }
+
+    void malformedChildOutput() const {
+        ErrorLoggerXml errorLogger;
+        // truncated packet
+        ASSERT_EQUALS(false, FunctionExecutor::reportChildOutput("O10 abc", errorLogger));
+        // no length
+        ASSERT_EQUALS(false, FunctionExecutor::reportChildOutput("O abc", errorLogger));
+        ASSERT_EQUALS(false, FunctionExecutor::reportChildOutput("Ox abc", errorLogger));
+        // unknown packet type
+        ASSERT_EQUALS(false, FunctionExecutor::reportChildOutput(packet('X', "abc"), errorLogger));
+        // error without message
+        ASSERT_EQUALS(false, FunctionExecutor::reportChildOutput(packet('E', packet('F', "test.c")), errorLogger));
+        // message that can't be deserialized
+        ASSERT_EQUALS(false, FunctionExecutor::reportChildOutput(packet('E', packet('M', "1 x")), errorLogger));
+        ASSERT_EQUALS(true, errorLogger.xml.empty());
+        ASSERT_EQUALS(true, FunctionExecutor::reportChildOutput("", errorLogger));
+    }
+};
+
+REGISTER_TEST(TestFunctionExecutor)
@@ -22,6 +22,7 @@
 #include "testsuite.h"
 #include "token.h"
 #include "tokenize.h"
+#include "tokenvisitor.h"
 
 #include <list>
 
@@ -251,6 +252,10 @@ private:
         for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it) {
             (*it)->runChecks(&tokenizer, &settings, this);
         }
+        TokenTraversal traversal;
+        for (std::list<Check *>::const_iterator it = Check::instances().begin(); it != Check::instances().end(); ++it)
+            (*it)->addVisitors(&traversal, &tokenizer, &settings, this);
+        traversal.run(tokenizer.tokens());
 
         tokenizer.simplifyTokenList2();
         // call all "runSimplifiedChecks" in all registered Check classes
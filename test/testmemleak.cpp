@@ -161,6 +161,9 @@ private:
         // Check that getcode works correctly..
         TEST_CASE(testgetcode);
 
+        // Check that only allocated variables are checked..
+        TEST_CASE(allocatedVariables);
+
         // check that call_func works correctly..
         TEST_CASE(call_func);
 
@@ -417,12 +420,42 @@ private:
 
         TokenList::deleteTokens(tokens);
 
+        // check() must not skip variables that are allocated or deallocated
+        if (varId > 0 && ret.str().find("alloc") != std::string::npos)
+            ASSERT_EQUALS(true, bool(checkMemoryLeak.allocatedVariables()[varId]));
+
         return ret.str();
     }
 
 
 
 
+    bool isAllocated(const char code[], const char varname[]) {
+        settings2.standards.posix = true;
+
+        // Tokenize..
+        Tokenizer tokenizer(&settings2, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+        tokenizer.simplifyTokenList2();
+
+        const CheckMemoryLeakInFunction checkMemoryLeak(&tokenizer, &settings2, nullptr);
+        return checkMemoryLeak.allocatedVariables()[Token::findmatch(tokenizer.tokens(), varname)->varId()];
+    }
+
+    void allocatedVariables() {
+        ASSERT_EQUALS(true, isAllocated("void f() { char *p = malloc(10); }", "p"));
+        ASSERT_EQUALS(true, isAllocated("void f() { char *p; p = realloc(p, 10); }", "p"));
+        ASSERT_EQUALS(true, isAllocated("void f() { int fd = open(a, b); }", "fd"));
+        ASSERT_EQUALS(true, isAllocated("void f(char *p) { free(p); }", "p"));
+        ASSERT_EQUALS(true, isAllocated("void f(char *p) { delete [] p; }", "p"));
+        ASSERT_EQUALS(true, isAllocated("void f() { char *p; g(&p); }", "p"));
+        ASSERT_EQUALS(true, isAllocated("void g(char *q) { free(q); } void f(char *p) { g(p); }", "p"));
+        ASSERT_EQUALS(false, isAllocated("void f(char *p) { p[0] = strlen(p); }", "p"));
+        ASSERT_EQUALS(false, isAllocated("void f(char *p) { dostuff(p + 1); }", "p"));
+        ASSERT_EQUALS(true, isAllocated("void f(char *p) { fcloseall(); }", "p"));
+    }
+
     void testgetcode() {
         // alloc;
         ASSERT_EQUALS(";;alloc;", getcode("int *a = malloc(100);", "a"));
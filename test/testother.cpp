@@ -23,6 +23,7 @@
 #include "standards.h"
 #include "testsuite.h"
 #include "tokenize.h"
+#include "tokenvisitor.h"
 
 #include <simplecpp.h>
 #include <tinyxml2.h>
@@ -122,6 +123,7 @@ private:
         TEST_CASE(duplicateBranch);
         TEST_CASE(duplicateBranch1); // tests extracted by http://www.viva64.com/en/b/0149/ ( Comparison between PVS-Studio and cppcheck ): Errors detected in Quake 3: Arena by PVS-Studio: Fragment 2
         TEST_CASE(duplicateBranch2); // empty macro
+        TEST_CASE(duplicateBranch3); // else if chain
         TEST_CASE(duplicateExpression1);
         TEST_CASE(duplicateExpression2); // ticket #2730
         TEST_CASE(duplicateExpression3); // ticket #3317
@@ -225,6 +227,9 @@ private:
         // Check..
         CheckOther checkOther(&tokenizer, settings, this);
         checkOther.runChecks(&tokenizer, settings, this);
+        TokenTraversal traversal;
+        checkOther.addVisitors(&traversal, &tokenizer, settings, this);
+        traversal.run(tokenizer.tokens());
 
         if (runSimpleChecks) {
             tokenizer.simplifyTokenList2();
@@ -269,6 +274,9 @@ private:
         // Check..
         CheckOther checkOther(&tokenizer, settings, this);
         checkOther.runChecks(&tokenizer, settings, this);
+        TokenTraversal traversal;
+        checkOther.addVisitors(&traversal, &tokenizer, settings, this);
+        traversal.run(tokenizer.tokens());
         tokenizer.simplifyTokenList2();
         checkOther.runSimplifiedChecks(&tokenizer, settings, this);
     }
@@ -3424,6 +3432,28 @@ private:
         ASSERT_EQUALS("", errout.str());
     }
 
+    void duplicateBranch3() {
+        check("void f(int a, int &b) {\n"
+              "    if (a == 1)\n"
+              "        b = 1;\n"
+              "    else if (a == 2)\n"
+              "        b = 2;\n"
+              "    else if (a == 3)\n"
+              "        b = 3;\n"
+              "    else\n"
+              "        b = 3;\n"
+              "}");
+        ASSERT_EQUALS("[test.cpp:8] -> [test.cpp:6]: (style, inconclusive) Found duplicate branches for 'if' and 'else'.\n", errout.str());
+
+        check("void f(int a, long &b) {\n"
+              "    if (a)\n"
+              "        b = (unsigned int)a;\n"
+              "    else\n"
+              "        b = (int)a;\n"
+              "}", nullptr, false, false, false);
+        ASSERT_EQUALS("", errout.str());
+    }
+
     void duplicateExpression1() {
         check("void foo(int a) {\n"
               "    if (a == a) { }\n"
@@ -113,6 +113,8 @@ private:
         TEST_CASE(templateNamePosition);
 
         TEST_CASE(expandSpecialized);
+
+        TEST_CASE(instantiationNames);
     }
 
     std::string tok(const char code[], bool simplify = true, bool debugwarnings = false, Settings::PlatformType type = Settings::Native) {
@@ -1473,6 +1475,24 @@ private:
         ASSERT_EQUALS("class A < int > { } ;", tok("template<> class A<int> {};"));
         ASSERT_EQUALS("class A < int > : public B { } ;", tok("template<> class A<int> : public B {};"));
     }
+
+    void instantiationNames() {
+        // templates that are never used are not instantiated
+        ASSERT_EQUALS("template < class T > struct A { T a ; } ; B < int > b ; struct B < int > { int b ; } ;", tok("template<class T> struct A { T a; };"
+                                 "template<class T> struct B { T b; };"
+                                 "B<int> b;"));
+
+        // usages that are added by the expanded code are instantiated
+        ASSERT_EQUALS("template < class T > struct C { T c ; } ; B < char > b ; struct B < char > { A < char > a ; } ; struct A < char > { char a ; } ;", tok("template<class T> struct A { T a; };"
+                                 "template<class T> struct B { A<T> a; };"
+                                 "template<class T> struct C { T c; };"
+                                 "B<char> b;"));
+
+        // calculations in the expanded code are simplified before the next instantiation
+        ASSERT_EQUALS("struct F < 0 > { } ; F < 2 > f ; struct F < 2 > { int x [ F < 1 > :: v ] ; } ; struct F < 1 > { int x [ F < 0 > :: v ] ; } ;", tok("template<int n> struct F { int x[F<n-1>::v]; static const int v = n; };"
+                                 "template<> struct F<0> { static const int v = 1; };"
+                                 "F<2> f;"));
+    }
 };
 
 REGISTER_TEST(TestSimplifyTemplate)
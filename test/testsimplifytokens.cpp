@@ -199,6 +199,7 @@ private:
 
         // remove calling convention __cdecl, __stdcall, ...
         TEST_CASE(simplifyCallingConvention);
+        TEST_CASE(simplifyFused);
 
         TEST_CASE(simplifyFunctorCall);
 
@@ -3302,6 +3303,34 @@ private:
         ASSERT_EQUALS("enum E { CALLBACK } ;", tok("enum E { CALLBACK } ;", true, Settings::Unix32));
     }
 
+    void simplifyFused() {
+        Settings settings;
+        settings.debugSimplifyRules = true;
+        settings.debugwarnings = true;
+        settings.platform(Settings::Win32W);
+
+        {
+            errout.str("");
+            Tokenizer tokenizer(&settings, this);
+            std::istringstream istr("__declspec(noreturn) void CALLBACK f(char *p) { ZeroMemory(p, 10); _tcscpy(p, _T(\"abc\")); }");
+            tokenizer.tokenize(istr, "test.cpp");
+            ASSERT_EQUALS("void f ( char * p ) { memset ( p , 0 , 10 ) ; wcscpy ( p , \"abc\" ) ; }", tokenizer.tokens()->stringifyList(0, false));
+            ASSERT_EQUALS("", errout.str());
+        }
+
+        {
+            // rule with missing triggers => fused and sequential results differ
+            errout.str("");
+            Tokenizer tokenizer(&settings, this);
+            std::istringstream istr("void f(char *p) { CopyMemory(p, \"abc\", 4); }");
+            tokenizer.list.createTokens(istr, "test.cpp");
+            std::vector<Tokenizer::SimplifyRule> rules;
+            rules.push_back(Tokenizer::SimplifyRule("simplifyMicrosoftMemoryFunctions", std::set<std::string>(), &Tokenizer::simplifyMicrosoftMemoryFunctions));
+            tokenizer.simplifyFused(rules);
+            ASSERT_EQUALS("[test.cpp:1]: (debug) Fused simplification differs from sequential simplification (simplifyMicrosoftMemoryFunctions).\n", errout.str());
+        }
+    }
+
     void simplifyFunctorCall() {
         ASSERT_EQUALS("IncrementFunctor ( ) ( a ) ;", tok("IncrementFunctor()(a);", true));
     }
@@ -170,6 +170,8 @@ private:
         TEST_CASE(simplifyTypedefFunction10); // #5191
 
         TEST_CASE(simplifyTypedefShadow);  // #4445 - shadow variable
+
+        TEST_CASE(simplifyTypedefUnused);
     }
 
     std::string tok(const char code[], bool simplify = true, Settings::PlatformType type = Settings::Native, bool debugwarnings = true) {
@@ -3034,6 +3036,17 @@ private:
         ASSERT_EQUALS("struct xyz { int x ; } ; void f ( ) { int abc ; int xyz ; }",
                       tok(code,false));
     }
+
+    void simplifyTypedefUnused() {
+        // typedefs that are not used are removed without scanning the rest of the code
+        ASSERT_EQUALS("unsigned int b ;", simplifyTypedef("typedef int A; typedef unsigned int B; B b;"));
+        ASSERT_EQUALS("int g ;", simplifyTypedef("typedef int *P, Q; typedef int (*F)(int); typedef void V(int); int g;"));
+        ASSERT_EQUALS("struct S { int x ; } ; struct T { int y ; } ; struct S s ;", simplifyTypedef("typedef struct { int x; } S; typedef struct T { int y; } T; S s;"));
+        ASSERT_EQUALS("namespace N { int a ; }", tok("namespace N { typedef int A; typedef int B; } namespace N { A a; }", false));
+        ASSERT_EQUALS("namespace N { void f ( ) { int t ; } } namespace N { int u ; }", tok("namespace N { typedef int T; typedef int U; } namespace N { void f() { T t; } } namespace N { T u; }", false));
+        ASSERT_EQUALS("class C { void f ( ) ; } ; void C :: f ( ) { int a ; }", tok("class C { typedef int A; typedef int B; void f(); }; void C::f() { A a; }", false));
+        ASSERT_EQUALS("struct S { char b ; } ; int a ; S c ;", tok("typedef int A; struct S { typedef char B; B b; }; typedef S C; A a; C c;", false));
+    }
 };
 
 REGISTER_TEST(TestSimplifyTypedef)
@@ -46,6 +46,7 @@ private:
         TEST_CASE(suppressionsSettings);
         TEST_CASE(suppressionsMultiFile);
         TEST_CASE(suppressionsPathSeparator);
+        TEST_CASE(suppressionsEverywhere);
 
         TEST_CASE(inlinesuppress_unusedFunction); // #4210 - unusedFunction
         TEST_CASE(globalsuppress_unusedFunction); // #4946
@@ -371,6 +372,24 @@ private:
         ASSERT_EQUALS(true, suppressions.isSuppressed("abc", "include\\1.h", 142));
     }
 
+    void suppressionsEverywhere() const {
+        Suppressions suppressions;
+        suppressions.addSuppressionLine("abc");
+        suppressions.addSuppressionLine("def:test.cpp");
+        suppressions.addSuppressionLine("ghi:*:12");
+        ASSERT_EQUALS(true, suppressions.isSuppressedEverywhere("abc"));
+        ASSERT_EQUALS(false, suppressions.isSuppressedEverywhere("def"));
+        ASSERT_EQUALS(false, suppressions.isSuppressedEverywhere("ghi"));
+        ASSERT_EQUALS(false, suppressions.isSuppressedEverywhere("jkl"));
+
+        // the glob suppressions "abc" and "ghi" are not matched
+        ASSERT_EQUALS(2U, suppressions.getUnmatchedGlobalSuppressions(true).size());
+
+        suppressions.addSuppressionLine("*");
+        ASSERT_EQUALS(true, suppressions.isSuppressedEverywhere("jkl"));
+        ASSERT_EQUALS(false, suppressions.isSuppressedEverywhere("unmatchedSuppression"));
+    }
+
     void inlinesuppress_unusedFunction() const { // #4210, #4946 - wrong report of "unmatchedSuppression" for "unusedFunction"
         Suppressions suppressions;
         suppressions.addSuppression("unusedFunction", "test.c", 3U);
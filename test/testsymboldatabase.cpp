@@ -28,6 +28,7 @@
 #include "utils.h"
 
 #include <cstddef>
+#include <deque>
 #include <list>
 #include <map>
 #include <set>
@@ -81,7 +82,7 @@ private:
     }
 
     static const Scope *findFunctionScopeByToken(const SymbolDatabase * db, const Token *tok) {
-        std::list<Scope>::const_iterator scope;
+        std::deque<Scope>::const_iterator scope;
 
         for (scope = db->scopeList.begin(); scope != db->scopeList.end(); ++scope) {
             if (scope->type == Scope::eFunction) {
@@ -282,6 +283,8 @@ private:
 
         TEST_CASE(sizeOfType);
 
+        TEST_CASE(scopeNameLookup);
+
         TEST_CASE(isImplicitlyVirtual);
         TEST_CASE(isPure);
 
@@ -1256,7 +1259,7 @@ private:
 
         if (db) {
             bool seen_something = false;
-            for (std::list<Scope>::const_iterator scope = db->scopeList.begin(); scope != db->scopeList.end(); ++scope) {
+            for (std::deque<Scope>::const_iterator scope = db->scopeList.begin(); scope != db->scopeList.end(); ++scope) {
                 for (std::list<Function>::const_iterator func = scope->functionList.begin(); func != scope->functionList.end(); ++func) {
                     ASSERT_EQUALS("Sub", func->token->str());
                     ASSERT_EQUALS(true, func->hasBody());
@@ -1488,7 +1491,7 @@ private:
 
         ASSERT(db && db->scopeList.size() == 1);
         if (db && db->scopeList.size() == 1) {
-            std::list<Scope>::const_iterator it = db->scopeList.begin();
+            std::deque<Scope>::const_iterator it = db->scopeList.begin();
             ASSERT(it->varlist.size() == 1);
             if (it->varlist.size() == 1) {
                 std::list<Variable>::const_iterator var = it->varlist.begin();
@@ -1503,7 +1506,7 @@ private:
 
         ASSERT(db && db->scopeList.size() == 1);
         if (db && db->scopeList.size() == 1) {
-            std::list<Scope>::const_iterator it = db->scopeList.begin();
+            std::deque<Scope>::const_iterator it = db->scopeList.begin();
             ASSERT(it->varlist.size() == 1);
             if (it->varlist.size() == 1) {
                 std::list<Variable>::const_iterator var = it->varlist.begin();
@@ -1518,7 +1521,7 @@ private:
 
         ASSERT(db && db->scopeList.size() == 1);
         if (db && db->scopeList.size() == 1) {
-            std::list<Scope>::const_iterator it = db->scopeList.begin();
+            std::deque<Scope>::const_iterator it = db->scopeList.begin();
             ASSERT(it->varlist.size() == 1);
             if (it->varlist.size() == 1) {
                 std::list<Variable>::const_iterator var = it->varlist.begin();
@@ -1865,7 +1868,7 @@ private:
         if (db) {
             ASSERT_EQUALS(3, db->scopeList.size());
             if (db->scopeList.size() == 3) {
-                std::list<Scope>::const_iterator scope = db->scopeList.begin();
+                std::deque<Scope>::const_iterator scope = db->scopeList.begin();
                 ++scope;
                 ASSERT_EQUALS((unsigned int)Scope::eClass, (unsigned int)scope->type);
                 ASSERT_EQUALS(1, scope->functionList.size());
@@ -1889,7 +1892,7 @@ private:
         if (db) {
             ASSERT_EQUALS(3, db->scopeList.size());
             if (db->scopeList.size() == 3) {
-                std::list<Scope>::const_iterator scope = db->scopeList.begin();
+                std::deque<Scope>::const_iterator scope = db->scopeList.begin();
                 ++scope;
                 ASSERT_EQUALS((unsigned int)Scope::eClass, (unsigned int)scope->type);
                 ASSERT_EQUALS(1, scope->functionList.size());
@@ -1974,7 +1977,7 @@ private:
 
         // Locate the scope for the class..
         const Scope *scope = nullptr;
-        for (std::list<Scope>::const_iterator it = db->scopeList.begin(); it != db->scopeList.end(); ++it) {
+        for (std::deque<Scope>::const_iterator it = db->scopeList.begin(); it != db->scopeList.end(); ++it) {
             if (it->isClassOrStruct()) {
                 scope = &(*it);
                 break;
@@ -2008,7 +2011,7 @@ private:
 
         // Locate the scope for the class..
         const Scope *scope = nullptr;
-        for (std::list<Scope>::const_iterator it = db->scopeList.begin(); it != db->scopeList.end(); ++it) {
+        for (std::deque<Scope>::const_iterator it = db->scopeList.begin(); it != db->scopeList.end(); ++it) {
             if (it->isClassOrStruct()) {
                 scope = &(*it);
                 break;
@@ -2297,7 +2300,7 @@ private:
 
         // Find the scope for the Fred struct..
         const Scope *fredScope = nullptr;
-        for (std::list<Scope>::const_iterator scope = db->scopeList.begin(); scope != db->scopeList.end(); ++scope) {
+        for (std::deque<Scope>::const_iterator scope = db->scopeList.begin(); scope != db->scopeList.end(); ++scope) {
             if (scope->isClassOrStruct() && scope->className == "Fred")
                 fredScope = &(*scope);
         }
@@ -2404,7 +2407,7 @@ private:
         ASSERT(db && db->typeList.size() == 5);
         if (!db || db->typeList.size() < 5)
             return;
-        std::list<Type>::const_iterator i = db->typeList.begin();
+        std::deque<Type>::const_iterator i = db->typeList.begin();
         const Type* Foo = &(*i++);
         const Type* Bar = &(*i++);
         const Type* Sub = &(*i++);
@@ -2473,7 +2476,7 @@ private:
         ASSERT(db && db->typeList.size() == 3);
         if (!db || db->typeList.size() != 3)
             return;
-        std::list<Type>::const_iterator i = db->typeList.begin();
+        std::deque<Type>::const_iterator i = db->typeList.begin();
         const Type* Fred = &(*i++);
         const Type* Wilma = &(*i++);
         const Type* Barney = &(*i++);
@@ -2567,7 +2570,7 @@ private:
             ASSERT(db->getVariableFromVarId(i) != nullptr);
 
         ASSERT_EQUALS(4U, db->scopeList.size());
-        std::list<Scope>::const_iterator scope = db->scopeList.begin();
+        std::deque<Scope>::const_iterator scope = db->scopeList.begin();
         ASSERT_EQUALS(Scope::eGlobal, scope->type);
         ++scope;
         ASSERT_EQUALS(Scope::eStruct, scope->type);
@@ -2585,7 +2588,7 @@ private:
 
         ASSERT(db != nullptr);
         ASSERT_EQUALS(4U, db->scopeList.size());
-        std::list<Scope>::const_iterator scope = db->scopeList.begin();
+        std::deque<Scope>::const_iterator scope = db->scopeList.begin();
         ASSERT_EQUALS(Scope::eGlobal, scope->type);
         ++scope;
         ASSERT_EQUALS(Scope::eStruct, scope->type);
@@ -2792,7 +2795,7 @@ private:
         if (db) {
             ASSERT(db->scopeList.size() == 4U);
             if (db->scopeList.size() == 4U) {
-                std::list<Scope>::const_iterator it = db->scopeList.begin();
+                std::deque<Scope>::const_iterator it = db->scopeList.begin();
                 ASSERT(it->type == Scope::eGlobal);
                 ASSERT((++it)->type == Scope::eFunction);
                 ASSERT((++it)->type == Scope::eIf);
@@ -2816,7 +2819,7 @@ private:
         if (db) {
             ASSERT(db->typeList.size() == 3U);
             if (db->typeList.size() == 3U) {
-                std::list<Type>::const_iterator it = db->typeList.begin();
+                std::deque<Type>::const_iterator it = db->typeList.begin();
                 const Type * classB = &(*it);
                 const Type * classC = &(*(++it));
                 const Type * classA = &(*(++it));
@@ -2881,7 +2884,7 @@ private:
         ASSERT_EQUALS(3U, db->scopeList.size());
 
         // Assert that all enum values are known
-        std::list<Scope>::const_iterator scope = db->scopeList.begin();
+        std::deque<Scope>::const_iterator scope = db->scopeList.begin();
 
         // Offsets
         ++scope;
@@ -2970,7 +2973,7 @@ private:
         ASSERT_EQUALS(2U, db->scopeList.size());
 
         // Assert that all enum values are known
-        std::list<Scope>::const_iterator scope = db->scopeList.begin();
+        std::deque<Scope>::const_iterator scope = db->scopeList.begin();
 
         ++scope;
         ASSERT_EQUALS((unsigned int)Scope::eEnum, (unsigned int)scope->type);
@@ -3100,6 +3103,43 @@ private:
         db->sizeOfType(e);  // <- don't crash
     }
 
+    void scopeNameLookup() {
+        GET_SYMBOL_DB("namespace N {\n"
+                      "    struct A { int x; int y; };\n"
+                      "    struct A;\n"
+                      "}\n"
+                      "enum class E;\n"
+                      "enum class E { E1 };\n"
+                      "void C() { }\n"
+                      "struct C { };\n");
+        ASSERT(db != nullptr);
+        if (!db)
+            return;
+        const Scope *global = &db->scopeList.front();
+
+        const Scope *N = global->findRecordInNestedList("N");
+        ASSERT(N && N->type == Scope::eNamespace);
+        if (!N)
+            return;
+        const Scope *A = N->findRecordInNestedList("A");
+        ASSERT(A && A->type == Scope::eStruct);
+        if (!A)
+            return;
+        ASSERT(N->findType("A") == A->definedType);
+        ASSERT_EQUALS(1U, N->definedTypes.size());
+        ASSERT(A->getVariable("y") == &A->varlist.back());
+        ASSERT(A->getVariable("z") == nullptr);
+
+        // the definition of a forward declared enum class gives the type its name
+        const Type *E = global->findType("E");
+        ASSERT(E && E->classScope != nullptr);
+
+        // function scopes are not records
+        const Scope *C = global->findRecordInNestedList("C");
+        ASSERT(C && C->type == Scope::eStruct);
+        ASSERT(global->findRecordInNestedList("D") == nullptr);
+    }
+
     void isImplicitlyVirtual() {
         {
             GET_SYMBOL_DB("class Base {\n"
@@ -4233,7 +4273,7 @@ private:
 
         ASSERT(db && db->scopeList.size() == 3);
         if (db && db->scopeList.size() == 3) {
-            std::list<Scope>::const_iterator scope = db->scopeList.begin();
+            std::deque<Scope>::const_iterator scope = db->scopeList.begin();
             ASSERT_EQUALS(Scope::eGlobal, scope->type);
             ++scope;
             ASSERT_EQUALS(Scope::eFunction, scope->type);
@@ -4254,7 +4294,7 @@ private:
 
         ASSERT(db && db->scopeList.size() == 3);
         if (db && db->scopeList.size() == 3) {
-            std::list<Scope>::const_iterator scope = db->scopeList.begin();
+            std::deque<Scope>::const_iterator scope = db->scopeList.begin();
             ASSERT_EQUALS(Scope::eGlobal, scope->type);
             ++scope;
             ASSERT_EQUALS(Scope::eFunction, scope->type);
@@ -4286,7 +4326,7 @@ private:
 
         ASSERT(db && db->scopeList.size() == 3);
         if (db && db->scopeList.size() == 3) {
-            std::list<Scope>::const_iterator scope = db->scopeList.begin();
+            std::deque<Scope>::const_iterator scope = db->scopeList.begin();
             ASSERT_EQUALS(Scope::eGlobal, scope->type);
             ++scope;
             ASSERT_EQUALS(Scope::eClass, scope->type);
@@ -16,8 +16,12 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "redirect.h"
+#include "settings.h"
 #include "testsuite.h"
 #include "timer.h"
+#include "token.h"
+#include "tokenlist.h"
 
 #include <cmath>
 #include <ctime>
@@ -31,6 +35,8 @@ private:
 
     void run() {
         TEST_CASE(result);
+        TEST_CASE(tree);
+        TEST_CASE(treeSeparateResults);
     }
 
     void result() const {
@@ -41,6 +47,69 @@ private:
         t1._clocks = CLOCKS_PER_SEC * 5 / 2;
         ASSERT(std::fabs(t1.seconds()-2.5) < 0.01);
     }
+
+    // Line of the --showtime=tree output for the given timer, without the
+    // times: "<indentation><number of results> result(s)[, <token delta> tokens])"
+    static std::string treeLine(const std::string &showtime, const std::string &name) {
+        const std::string::size_type pos = showtime.find(name + ": ");
+        if (pos == std::string::npos)
+            return "";
+        const std::string::size_type lineStart = showtime.rfind('\n', pos) + 1;
+        const std::string::size_type start = showtime.find(" - ", pos) + 3;
+        const std::string::size_type end = showtime.find('\n', pos);
+        return std::string(pos - lineStart, ' ') + showtime.substr(start, end - start);
+    }
+
+    void tree() const {
+        Settings settings;
+        TokenList tokenlist(&settings);
+        tokenlist.addtoken("a", 1, 0);
+        tokenlist.addtoken("b", 1, 0);
+
+        TimerResults results;
+        {
+            Timer outer("outer", SHOWTIME_TREE, &results, &tokenlist);
+            TimerSteps steps("outer::pass", SHOWTIME_TREE, &results, &tokenlist);
+            steps.step("first");
+            tokenlist.addtoken("c", 1, 0);
+            tokenlist.addtoken("d", 1, 0);
+            steps.step("second");
+            tokenlist.front()->deleteNext();
+            steps.step("third");
+            steps.Stop();
+            outer.Stop();
+        }
+        ASSERT_EQUALS(3U, tokenlist.tokenCount());
+
+        REDIRECT;
+        results.ShowResults(SHOWTIME_TREE);
+        const std::string showtime = GET_REDIRECT_OUTPUT;
+        ASSERT_EQUALS("1 result(s), +1 tokens)", treeLine(showtime, "outer"));
+        ASSERT_EQUALS("  1 result(s), +2 tokens)", treeLine(showtime, "outer::pass::first"));
+        ASSERT_EQUALS("  1 result(s), -1 tokens)", treeLine(showtime, "outer::pass::second"));
+        ASSERT_EQUALS("  1 result(s))", treeLine(showtime, "outer::pass::third"));
+        ASSERT(showtime.find("Overall time: ") != std::string::npos);
+    }
+
+    void treeSeparateResults() const {
+        // timers of different results don't nest
+        TimerResults results1, results2;
+        {
+            Timer t1("t1", SHOWTIME_TREE, &results1);
+            Timer t2("t2", SHOWTIME_TREE, &results2);
+            Timer t3("t3", SHOWTIME_TREE, &results1);
+        }
+
+        REDIRECT;
+        results1.ShowResults(SHOWTIME_TREE);
+        const std::string output1 = GET_REDIRECT_OUTPUT;
+        CLEAR_REDIRECT_OUTPUT;
+        results2.ShowResults(SHOWTIME_TREE);
+        const std::string output2 = GET_REDIRECT_OUTPUT;
+        ASSERT_EQUALS("1 result(s))", treeLine(output1, "t1"));
+        ASSERT_EQUALS("  1 result(s))", treeLine(output1, "t3"));
+        ASSERT_EQUALS("1 result(s))", treeLine(output2, "t2"));
+    }
 };
 
 REGISTER_TEST(TestTimer)
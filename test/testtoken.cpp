@@ -97,7 +97,12 @@ private:
         TEST_CASE(canFindMatchingBracketsWithTooManyClosing);
         TEST_CASE(canFindMatchingBracketsWithTooManyOpening);
 
+        TEST_CASE(findmatchFirstToken);
+        TEST_CASE(findsimplematchFirstToken);
+
         TEST_CASE(expressionString);
+
+        TEST_CASE(addValue);
     }
 
     void nextprevious() const {
@@ -313,12 +318,12 @@ private:
 
 
     void deleteLast() const {
-        Token *tokensBack = 0;
-        Token tok(&tokensBack);
+        TokensFrontBack listEnds;
+        Token tok(&listEnds);
         tok.insertToken("aba");
-        ASSERT_EQUALS(true, tokensBack == tok.next());
+        ASSERT_EQUALS(true, listEnds.back == tok.next());
         tok.deleteNext();
-        ASSERT_EQUALS(true, tokensBack == &tok);
+        ASSERT_EQUALS(true, listEnds.back == &tok);
     }
 
     void nextArgument() const {
@@ -948,6 +953,31 @@ private:
         ASSERT(t == nullptr);
     }
 
+    void findmatchFirstToken() const {
+        givenACodeSampleToTokenize var("void f(int *p) { if (x) { delete p; } return; }");
+        const Token *tok = Token::findmatch(var.tokens(), "free|delete %name% ;");
+        ASSERT(tok && tok->str() == "delete");
+        tok = Token::findmatch(var.tokens(), "[;}] return");
+        ASSERT(tok && tok->str() == "}" && tok->next()->str() == "return");
+        tok = Token::findmatch(var.tokens(), "{|( %name% )|*");
+        ASSERT(tok && tok->str() == "(" && tok->strAt(1) == "int");
+        ASSERT(Token::findmatch(var.tokens(), "!!void f (") == nullptr);
+        ASSERT(Token::findmatch(var.tokens(), "!!int f (") == var.tokens());
+        ASSERT(Token::findmatch(var.tokens(), "%name%|} return") != nullptr);
+        ASSERT(Token::findmatch(var.tokens(), "|return ;") != nullptr);
+        ASSERT(Token::findmatch(var.tokens(), "free|malloc (") == nullptr);
+        ASSERT(Token::findmatch(var.tokens(), "delete p", Token::findsimplematch(var.tokens(), "if")) == nullptr);
+    }
+
+    void findsimplematchFirstToken() const {
+        givenACodeSampleToTokenize var("void f(int *p) { if (x) { delete p; } return; }");
+        const Token *tok = Token::findsimplematch(var.tokens(), "delete p ;");
+        ASSERT(tok && tok->str() == "delete");
+        ASSERT(Token::findsimplematch(var.tokens(), "delete x") == nullptr);
+        ASSERT(Token::findsimplematch(var.tokens(), "delete|free") == nullptr);
+        ASSERT(Token::findsimplematch(var.tokens(), "return ;", tok) == nullptr);
+    }
+
     void expressionString() {
         givenACodeSampleToTokenize var1("void f() { *((unsigned long long *)x) = 0; }");
         const Token *tok1 = Token::findsimplematch(var1.tokens(), "*");
@@ -957,6 +987,41 @@ private:
         const Token *tok2 = Token::findsimplematch(var2.tokens(), "*");
         ASSERT_EQUALS("*((unsigned long long*)x)", tok2->expressionString());
     }
+
+    void addValue() const {
+        Token tok(0);
+        tok.str("x");
+
+        ValueFlow::Value v1(1);
+        v1.setPossible();
+        ASSERT_EQUALS(true, tok.addValue(v1));
+        ASSERT_EQUALS(false, tok.addValue(v1)); // same value is not added again
+        ValueFlow::Value v2(2);
+        v2.setPossible();
+        ASSERT_EQUALS(true, tok.addValue(v2));
+        ASSERT_EQUALS(2U, tok.values().size());
+        ASSERT(tok.getValue(2) == &tok.values().back());
+        ASSERT(tok.getValue(3) == nullptr);
+        ASSERT_EQUALS(2, tok.getMaxValue(false)->intvalue);
+
+        // no more than 10 values
+        for (int i = 3; i <= 20; ++i) {
+            ValueFlow::Value v(i);
+            v.setPossible();
+            tok.addValue(v);
+        }
+        ASSERT_EQUALS(10U, tok.values().size());
+
+        // a known value replaces all other values
+        ValueFlow::Value known(5);
+        known.setKnown();
+        ASSERT_EQUALS(true, tok.addValue(known));
+        ASSERT_EQUALS(1U, tok.values().size());
+        ASSERT_EQUALS(true, tok.hasKnownIntValue());
+
+        tok.clearValueFlow();
+        ASSERT_EQUALS(true, tok.values().empty());
+    }
 };
 
 REGISTER_TEST(TestToken)
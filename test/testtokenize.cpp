@@ -323,6 +323,7 @@ private:
         TEST_CASE(removeRedundantAssignment);
 
         TEST_CASE(removedeclspec);
+        TEST_CASE(declspecCallingConvention);
         TEST_CASE(removeattribute);
         TEST_CASE(functionAttributeBefore);
         TEST_CASE(functionAttributeAfter);
@@ -4818,6 +4819,23 @@ private:
         ASSERT_EQUALS("__property int x [ ] ;", tokenizeAndStringify("__declspec(property(get=GetX, put=PutX)) int x[];"));
     }
 
+    void declspecCallingConvention() {
+        // the calling convention is removed before __declspec() is
+        const char code[] = "void __declspec(noreturn) __stdcall f1();\n"
+                            "void __declspec(nothrow) __cdecl f2();";
+
+        errout.str("");
+        Tokenizer tokenizer(&settings0, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+        ASSERT_EQUALS("void f1 ( ) ; void f2 ( ) ;", tokenizer.tokens()->stringifyList(0, false));
+
+        const Token * f1 = Token::findsimplematch(tokenizer.tokens(), "f1");
+        const Token * f2 = Token::findsimplematch(tokenizer.tokens(), "f2");
+        ASSERT(f1 && f1->isAttributeNoreturn());
+        ASSERT(f2 && f2->isAttributeNothrow());
+    }
+
     void removeattribute() {
         ASSERT_EQUALS("short array [ 3 ] ;", tokenizeAndStringify("short array[3] __attribute__ ((aligned));"));
         ASSERT_EQUALS("int x [ 2 ] ;", tokenizeAndStringify("int x[2] __attribute__ ((packed));"));
@@ -19,6 +19,7 @@
 #include "settings.h"
 #include "testsuite.h"
 #include "token.h"
+#include "tokenize.h"
 #include "tokenlist.h"
 
 #include <sstream>
@@ -36,6 +37,9 @@ private:
         TEST_CASE(testaddtoken1);
         TEST_CASE(testaddtoken2);
         TEST_CASE(inc);
+        TEST_CASE(tokensWithStr);
+        TEST_CASE(tokensWithType);
+        TEST_CASE(isVariableChanged);
     }
 
     // inspired by #5895
@@ -73,6 +77,77 @@ private:
 
         ASSERT(Token::simpleMatch(tokenlist.front(), "a + + 1 ; 1 + + b ;"));
     }
+
+    void tokensWithStr() const {
+        const char code[] = "x = 1; y = 2; throw x;";
+        TokenList tokenlist(&settings);
+        std::istringstream istr(code);
+        tokenlist.createTokens(istr, "a.cpp");
+
+        ASSERT_EQUALS(2U, tokenlist.tokensWithStr("=").size());
+        ASSERT_EQUALS(1U, tokenlist.tokensWithStr("throw").size());
+        ASSERT_EQUALS(0U, tokenlist.tokensWithStr("delete").size());
+        ASSERT_EQUALS("y", tokenlist.tokensWithStr("=")[1]->previous()->str());
+
+        // index is updated when tokens are modified
+        Token *tok = tokenlist.front();
+        tok->str("delete");
+        ASSERT_EQUALS(1U, tokenlist.tokensWithStr("delete").size());
+        tok->insertToken("=");
+        ASSERT_EQUALS(3U, tokenlist.tokensWithStr("=").size());
+        ASSERT(tok->next() == tokenlist.tokensWithStr("=")[0]);
+        tok->deleteNext(2);
+        ASSERT_EQUALS(1U, tokenlist.tokensWithStr("=").size());
+
+        tokenlist.back()->insertToken("throw");
+        ASSERT_EQUALS(2U, tokenlist.tokensWithStr("throw").size());
+        ASSERT(tokenlist.back() == tokenlist.tokensWithStr("throw")[1]);
+    }
+
+    void tokensWithType() const {
+        const char code[] = "x = \"a\"; y = \"b\";";
+        TokenList tokenlist(&settings);
+        std::istringstream istr(code);
+        tokenlist.createTokens(istr, "a.cpp");
+
+        ASSERT_EQUALS(2U, tokenlist.tokensWithType(Token::eString).size());
+        ASSERT_EQUALS(2U, tokenlist.tokensWithType(Token::eAssignmentOp).size());
+        ASSERT_EQUALS(0U, tokenlist.tokensWithType(Token::eVariable).size());
+
+        tokenlist.front()->varId(1);
+        ASSERT_EQUALS(1U, tokenlist.tokensWithType(Token::eVariable).size());
+        ASSERT_EQUALS(1U, tokenlist.tokensWithType(Token::eName).size());
+    }
+
+    void isVariableChanged() {
+        const char code[] = "int g; void f(int x, int y) { y = x; foo(); x = 1; }";
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+        const TokenList &tokenlist = tokenizer.list;
+
+        Token * const start = const_cast<Token *>(Token::findsimplematch(tokenizer.tokens(), "{"));
+        const Token * const mid = Token::findsimplematch(start, "foo");
+        const Token * const end = start->link();
+        const unsigned int g = tokenizer.tokens()->next()->varId();
+        const unsigned int x = Token::findsimplematch(start, "x")->varId();
+        const unsigned int y = start->next()->varId();
+
+        ASSERT_EQUALS(false, tokenlist.isVariableChanged(start, mid, x, false));
+        ASSERT_EQUALS(true, tokenlist.isVariableChanged(start, mid, y, false));
+        ASSERT_EQUALS(true, tokenlist.isVariableChanged(mid, end, x, false));
+        ASSERT_EQUALS(false, tokenlist.isVariableChanged(mid, end, y, false));
+        ASSERT_EQUALS(false, tokenlist.isVariableChanged(start, mid, g, true));
+        ASSERT_EQUALS(true, tokenlist.isVariableChanged(mid, end, g, true));
+        ASSERT_EQUALS(false, tokenlist.isVariableChanged(mid, mid, y, true));
+
+        // index is updated when tokens are modified
+        start->insertToken(";");
+        start->insertToken("++");
+        start->insertToken("x");
+        start->next()->varId(x);
+        ASSERT_EQUALS(true, tokenlist.isVariableChanged(start, mid, x, false));
+    }
 };
 
 REGISTER_TEST(TestTokenList)
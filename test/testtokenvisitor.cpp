@@ -0,0 +1,104 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2016 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "settings.h"
+#include "symboldatabase.h"
+#include "testsuite.h"
+#include "token.h"
+#include "tokenize.h"
+#include "tokenvisitor.h"
+
+#include <sstream>
+#include <string>
+
+
+class TestTokenVisitor : public TestFixture {
+public:
+    TestTokenVisitor() : TestFixture("TestTokenVisitor") {
+    }
+
+private:
+    Settings settings;
+
+    void run() {
+        TEST_CASE(tokens);
+        TEST_CASE(astOperators);
+        TEST_CASE(scopes);
+    }
+
+    /** Writes the events it gets to a string */
+    class Recorder : public TokenVisitor {
+    public:
+        explicit Recorder(std::string *events) : TokenVisitor("Recorder"), _events(events) {
+        }
+
+        void visitToken(const Token *tok) {
+            *_events += tok->str() + " ";
+        }
+
+        void scopeBegin(const Scope *scope) {
+            *_events += "begin:" + scope->className + " ";
+        }
+
+        void scopeEnd(const Scope *scope) {
+            *_events += "end:" + scope->className + " ";
+        }
+
+    private:
+        std::string *_events;
+    };
+
+    std::string traverse(const char code[], Token::Type tokens, Token::Type astOperators, bool scopes) {
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+
+        std::string events;
+        Recorder *recorder = new Recorder(&events);
+        if (tokens != Token::eNone)
+            recorder->subscribeTokens(tokens);
+        if (astOperators != Token::eNone)
+            recorder->subscribeAstOperators(astOperators);
+        if (scopes)
+            recorder->subscribeScopes();
+        TokenTraversal traversal;
+        traversal.add(recorder);
+        traversal.run(tokenizer.tokens());
+        return events;
+    }
+
+    void tokens() {
+        ASSERT_EQUALS("x y x y x ", traverse("void f(int x, int y) { x = y + x; }", Token::eVariable, Token::eNone, false));
+        ASSERT_EQUALS("", traverse("void f(int x) { x = 0; }", Token::eNone, Token::eNone, false));
+    }
+
+    void astOperators() {
+        // the '*' in the cast has no operand
+        ASSERT_EQUALS("* ", traverse("void f(int x) { g((char *)0, x * 2); }", Token::eNone, Token::eArithmeticalOp, false));
+        ASSERT_EQUALS("* * ", traverse("void f(int x) { g((char *)0, x * 2); }", Token::eArithmeticalOp, Token::eArithmeticalOp, false));
+    }
+
+    void scopes() {
+        ASSERT_EQUALS("begin:f begin: end: end:f ", traverse("void f(int x) { if (x) { g(); } }", Token::eNone, Token::eNone, true));
+        ASSERT_EQUALS("begin:f { begin: { } end: } end:f ", traverse("void f(int x) { if (x) { g(); } }", Token::eBracket, Token::eNone, true));
+        ASSERT_EQUALS("begin:A begin:f end:f end:A ", traverse("struct A { void f() { } };", Token::eNone, Token::eNone, true));
+    }
+};
+
+REGISTER_TEST(TestTokenVisitor)
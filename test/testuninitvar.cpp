@@ -75,6 +75,7 @@ private:
         TEST_CASE(uninitvar_pointertoarray);
         TEST_CASE(uninitvar_cpp11ArrayInit); // #7010
         TEST_CASE(uninitvar_rangeBasedFor); // #7078
+        TEST_CASE(uninitvar_longFunction); // definite assignment in the control flow graph
         TEST_CASE(trac_4871);
         TEST_CASE(syntax_error); // Ticket #5073
         TEST_CASE(trac_5970);
@@ -3767,6 +3768,38 @@ private:
         ASSERT_EQUALS("", errout.str());
     }
 
+    void uninitvar_longFunction() {
+        // in long functions variables that are assigned on every path are not checked further
+        const std::string filler(100, '\n');
+        checkUninitVar(("int f(int x) {\n"
+                        "    int a;\n"
+                        "    if (x) { a = 1; } else { a = 2; }\n" + filler +
+                        "    return a;\n"
+                        "}").c_str());
+        ASSERT_EQUALS("", errout.str());
+
+        checkUninitVar(("int f(int x) {\n"
+                        "    int a;\n"
+                        "    switch (x) { case 1: a = 1; break; default: a = 2; break; }\n" + filler +
+                        "    return a;\n"
+                        "}").c_str());
+        ASSERT_EQUALS("", errout.str());
+
+        checkUninitVar(("int f(int x) {\n"
+                        "    int a;\n"
+                        "    if (x) { a = 1; }\n" + filler +
+                        "    return a;\n"
+                        "}").c_str());
+        ASSERT_EQUALS("[test.cpp:104]: (error) Uninitialized variable: a\n", errout.str());
+
+        checkUninitVar(("int f(int x) {\n"
+                        "    int a;\n"
+                        "    do { a = x; } while (--x);\n" + filler +
+                        "    return a;\n"
+                        "}").c_str());
+        ASSERT_EQUALS("", errout.str());
+    }
+
     void trac_4871() { // #4871
         checkUninitVar("void pickup(int a) {\n"
                        "bool using_planner_action;\n"
@@ -83,6 +83,7 @@ private:
         TEST_CASE(valueFlowForLoop);
         TEST_CASE(valueFlowSubFunction);
         TEST_CASE(valueFlowFunctionReturn);
+        TEST_CASE(getReturnValues);
 
         TEST_CASE(valueFlowFunctionDefaultParameter);
 
@@ -105,7 +106,7 @@ private:
 
         for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
             if (tok->str() == "x" && tok->linenr() == linenr) {
-                std::list<ValueFlow::Value>::const_iterator it;
+                std::vector<ValueFlow::Value>::const_iterator it;
                 for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                     if (it->isIntValue() && it->intvalue == value)
                         return true;
@@ -127,11 +128,11 @@ private:
                 continue;
 
             std::ostringstream ostr;
-            std::list<ValueFlow::Value>::const_iterator it;
+            std::vector<ValueFlow::Value>::const_iterator it;
             for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                 for (ValueFlow::Value::ErrorPath::const_iterator ep = it->errorPath.begin(); ep != it->errorPath.end(); ++ep) {
-                    const Token *eptok = ep->first;
-                    const std::string &msg = ep->second;
+                    const Token *eptok = ep->tok;
+                    const std::string msg = ep->str();
                     ostr << eptok->linenr() << ',' << msg << '\n';
                 }
             }
@@ -149,7 +150,7 @@ private:
 
         for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
             if (tok->str() == "x" && tok->linenr() == linenr) {
-                std::list<ValueFlow::Value>::const_iterator it;
+                std::vector<ValueFlow::Value>::const_iterator it;
                 for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                     if (it->isTokValue() && Token::simpleMatch(it->tokvalue, value))
                         return true;
@@ -168,7 +169,7 @@ private:
 
         for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
             if (tok->str() == "x" && tok->linenr() == linenr) {
-                std::list<ValueFlow::Value>::const_iterator it;
+                std::vector<ValueFlow::Value>::const_iterator it;
                 for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                     if (it->isMovedValue() && it->moveKind == moveKind)
                         return true;
@@ -187,7 +188,7 @@ private:
 
         for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
             if (tok->str() == "x" && tok->linenr() == linenr) {
-                std::list<ValueFlow::Value>::const_iterator it;
+                std::vector<ValueFlow::Value>::const_iterator it;
                 for (it = tok->values().begin(); it != tok->values().end(); ++it) {
                     if (it->isIntValue() && it->intvalue == value && it->condition)
                         return true;
@@ -225,7 +226,7 @@ private:
         errout.str("");
         tokenizer.tokenize(istr, "test.cpp");
         const Token *tok = Token::findmatch(tokenizer.tokens(), tokstr);
-        return tok ? tok->values() : std::list<ValueFlow::Value>();
+        return tok ? std::list<ValueFlow::Value>(tok->values().begin(), tok->values().end()) : std::list<ValueFlow::Value>();
     }
 
     ValueFlow::Value valueOfTok(const char code[], const char tokstr[]) {
@@ -2000,6 +2001,16 @@ private:
                "}";
         ASSERT_EQUALS(true, testValueOfX(code, 1U, 123));
 
+        // same values are passed once
+        code = "void f1(int x) { return x; }\n"
+               "void f2() {\n"
+               "    f1(1);\n"
+               "    f1(2);\n"
+               "    f1(1);\n"
+               "}";
+        ASSERT_EQUALS(true, testValueOfX(code, 1U, 1));
+        ASSERT_EQUALS(true, testValueOfX(code, 1U, 2));
+
         code = "void f1(int x) { return x; }\n"
                "void f2(int x) {\n"
                "    f1(x);\n"
@@ -2037,6 +2048,12 @@ private:
                "void f2(int y) { f1(123); }\n";
         ASSERT_EQUALS(true, testValueOfX(code, 1U, 123));
 
+        // value is passed on from the called function
+        code = "void f1(int x) { a=x; }\n"
+               "void f2(int y) { f1(y); }\n"
+               "void f3() { f2(123); }\n";
+        ASSERT_EQUALS(true, testValueOfX(code, 1U, 123));
+
         code = "void f1(int x) {\n"
                "  x ?\n"
                "  1024 / x :\n"
@@ -2151,6 +2168,18 @@ private:
         ASSERT_EQUALS(6, valueOfTok(code, "*").intvalue);
         ASSERT_EQUALS(true, valueOfTok(code, "*").isKnown());
 
+        // return value is reused for the same arguments
+        code = "int f1(int x) {\n"
+               "  return x+1;\n"
+               "}\n"
+               "void f2() {\n"
+               "    a = 10 - f1(2);\n"
+               "    b = 2 * f1(2);\n"
+               "}";
+        ASSERT_EQUALS(7, valueOfTok(code, "-").intvalue);
+        ASSERT_EQUALS(6, valueOfTok(code, "*").intvalue);
+        ASSERT_EQUALS(true, valueOfTok(code, "*").isKnown());
+
         code = "int f(int i, X x) {\n"
                "    if (i)\n"
                "        return g(std::move(x));\n"
@@ -2184,6 +2213,50 @@ private:
         ASSERT_EQUALS(false, valueOfTok(code, "-").isKnown());
     }
 
+    std::map<std::string, long long> getReturnValues(const char code[]) {
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        tokenizer.tokenize(istr, "test.cpp");
+        std::map<std::string, long long> returnValues;
+        ValueFlow::getReturnValues(tokenizer.getSymbolDatabase(), &returnValues);
+        return returnValues;
+    }
+
+    void getReturnValues() {
+        std::map<std::string, long long> returnValues;
+
+        returnValues = getReturnValues("int f1() { return 1 + 2; }\n"
+                                       "int f2(int x) { return 4; }\n"
+                                       "int *f3() { return 0; }");
+        ASSERT_EQUALS(3U, returnValues.size());
+        ASSERT_EQUALS(3, returnValues["f1()"]);
+        ASSERT_EQUALS(4, returnValues["f2(int)"]);
+        ASSERT_EQUALS(0, returnValues["f3()"]);
+
+        // depends on the arguments or on global variables
+        returnValues = getReturnValues("int g;\n"
+                                       "int f1(int x) { return x + 1; }\n"
+                                       "int f2() { return g; }");
+        ASSERT_EQUALS(0U, returnValues.size());
+
+        // not visible in other TUs
+        returnValues = getReturnValues("static int f1() { return 1; }\n"
+                                       "struct A { int f2() { return 2; } };\n"
+                                       "namespace N { int f3() { return 3; } }");
+        ASSERT_EQUALS(0U, returnValues.size());
+
+        // overloads with the same number of arguments
+        returnValues = getReturnValues("int f(int x) { return 1; }\n"
+                                       "int f(char *s) { return 2; }\n"
+                                       "int f(const char *s) { return 3; }\n"
+                                       "int f(double) { return 4; }");
+        ASSERT_EQUALS(4U, returnValues.size());
+        ASSERT_EQUALS(1, returnValues["f(int)"]);
+        ASSERT_EQUALS(2, returnValues["f(char *)"]);
+        ASSERT_EQUALS(3, returnValues["f(const char *)"]);
+        ASSERT_EQUALS(4, returnValues["f(double)"]);
+    }
+
     void valueFlowFunctionDefaultParameter() {
         const char *code;
 
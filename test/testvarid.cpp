@@ -173,9 +173,12 @@ private:
         TEST_CASE(varidclass17);  // #6073
         TEST_CASE(varidclass18);
         TEST_CASE(varidclass19);  // initializer list
+        TEST_CASE(varidclass20);  // member functions of several classes
         TEST_CASE(varid_classnameshaddowsvariablename); // #3990
 
         TEST_CASE(varidnamespace1);
+
+        TEST_CASE(varid_nestedscopes);
     }
 
     std::string tokenize(const char code[], bool simplify = false, const char filename[] = "test.cpp") {
@@ -2737,6 +2740,23 @@ private:
         ASSERT_EQUALS(expected, tokenize(code));
     }
 
+    void varidclass20() {
+        const char code[] = "class A { int x; void f(); };\n"
+                            "class B : public A { int y; B(); void f(); };\n"
+                            "namespace N { class A { int z; void f(); }; }\n"
+                            "void A::f() { x = 0; }\n"
+                            "B::B() : y(0) { }\n"
+                            "void B::f() { x = y; }\n"
+                            "void N::A::f() { z = 1; }\n";
+        ASSERT_EQUALS("1: class A { int x@1 ; void f ( ) ; } ;\n"
+                      "2: class B : public A { int y@2 ; B ( ) ; void f ( ) ; } ;\n"
+                      "3: namespace N { class A { int z@3 ; void f ( ) ; } ; }\n"
+                      "4: void A :: f ( ) { x@1 = 0 ; }\n"
+                      "5: B :: B ( ) : y@2 ( 0 ) { }\n"
+                      "6: void B :: f ( ) { x@1 = y@2 ; }\n"
+                      "7: void N :: A :: f ( ) { z@3 = 1 ; }\n", tokenize(code));
+    }
+
     void varid_classnameshaddowsvariablename() {
         const char code[] = "class Data;\n"
                             "void strange_declarated(const Data& Data);\n"
@@ -2769,6 +2789,23 @@ private:
 
         ASSERT_EQUALS(expected, tokenize(code));
     }
+
+    void varid_nestedscopes() {
+        const char code[] = "int a;\n"
+                            "void f(int a) {\n"
+                            "    { int a; a = 1; { a = 2; int a = a; } a = 3; }\n"
+                            "    for (int a = 0; a < 2; a++) { }\n"
+                            "    a = 4;\n"
+                            "}\n"
+                            "void g() { a = 5; }\n";
+        ASSERT_EQUALS("1: int a@1 ;\n"
+                      "2: void f ( int a@2 ) {\n"
+                      "3: { int a@3 ; a@3 = 1 ; { a@3 = 2 ; int a@4 ; a@4 = a@4 ; } a@3 = 3 ; }\n"
+                      "4: for ( int a@5 = 0 ; a@5 < 2 ; a@5 ++ ) { }\n"
+                      "5: a@2 = 4 ;\n"
+                      "6: }\n"
+                      "7: void g ( ) { a@1 = 5 ; }\n", tokenize(code));
+    }
 };
 
 REGISTER_TEST(TestVarID)
@@ -207,6 +207,41 @@ class MatchCompiler:
 
         return ret
 
+    @staticmethod
+    def _compileFirstTokenFilter(pattern):
+        """Jump table on the first character of the token for find patterns
+        that start with several literal alternatives ("delete|free|fclose"),
+        so most tokens are skipped without any string comparison."""
+        tokens = [tok for tok in pattern.split(' ') if tok != '']
+        if not tokens:
+            return ''
+        first = tokens[0]
+        if first.find('|') <= 0 or first[0:2] == '!!' or '%' in first:
+            return ''
+        # "[abc]" and "[|]" are character sets, not alternatives
+        if first[0] == '[' and len(first) > 1:
+            return ''
+        alternatives = first.split('|')
+        if '' in alternatives:
+            return ''
+
+        chars = []
+        for alternative in alternatives:
+            c = alternative[0]
+            if c not in chars:
+                chars.append(c)
+
+        ret = '    switch (start_tok->str()[0]) {\n'
+        for c in chars:
+            if c in ('\\', '\''):
+                c = '\\' + c
+            ret += "    case '" + c + "':\n"
+        ret += '        break;\n'
+        ret += '    default:\n'
+        ret += '        continue;\n'
+        ret += '    }\n'
+        return ret
+
     def _compileFindPattern(self, pattern, findmatchnr, endToken, varId):
         more_args = ''
         endCondition = ''
@@ -222,6 +257,7 @@ class MatchCompiler:
         ret += '    for (; start_tok' + endCondition + \
             '; start_tok = start_tok->next()) {\n'
 
+        ret += self._compileFirstTokenFilter(pattern)
         ret += self._compilePattern(pattern, -1, varId, True, 'T')
         ret += '    }\n'
         ret += '    return NULL;\n}\n'
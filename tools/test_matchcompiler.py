@@ -136,6 +136,24 @@ class MatchCompilerTest(unittest.TestCase):
         self.assertEqual(
             output, 'if (findmatch4(tok->next()->next(), tok->link(), 123) ) {')
 
+    def test_compileFirstTokenFilter(self):
+        # a single literal is already rejected by the first comparison
+        self.assertEqual('', self.mc._compileFirstTokenFilter('return ;'))
+        self.assertEqual('', self.mc._compileFirstTokenFilter('%name%|return ;'))
+        self.assertEqual('', self.mc._compileFirstTokenFilter('return| ;'))
+        self.assertEqual('', self.mc._compileFirstTokenFilter('!!return ;'))
+        self.assertEqual('', self.mc._compileFirstTokenFilter('[|] ;'))
+        self.assertEqual('', self.mc._compileFirstTokenFilter('[;{}]|return ;'))
+
+        output = self.mc._compileFirstTokenFilter('delete|free|fclose (')
+        self.assertEqual('    switch (start_tok->str()[0]) {\n'
+                         "    case 'd':\n"
+                         "    case 'f':\n"
+                         '        break;\n'
+                         '    default:\n'
+                         '        continue;\n'
+                         '    }\n', output)
+
     def test_parseStringComparison(self):
         input = 'str == "abc"'
         # offset '5' is chosen as an abritary start offset to look for